@@ -0,0 +1,78 @@
+-- Generates the data used by the benchmarks in benchmark/mysql
+-- Usage: mysql -u root -h 127.0.0.1 < benchmark/mysql/bench_data.sql
+DROP SCHEMA IF EXISTS mysqlbench;
+CREATE SCHEMA mysqlbench;
+USE mysqlbench;
+
+SET SESSION cte_max_recursion_depth = 10000000;
+
+-- a narrow table of integers (one million rows)
+CREATE TABLE bench_narrow(id BIGINT NOT NULL PRIMARY KEY, i INTEGER);
+INSERT INTO bench_narrow
+WITH RECURSIVE seq(n) AS (SELECT 0 UNION ALL SELECT n + 1 FROM seq WHERE n < 999999)
+SELECT n, n % 1000 FROM seq;
+
+-- a wide table with one column of every commonly used type (one million rows)
+CREATE TABLE bench_wide(
+	id BIGINT NOT NULL PRIMARY KEY,
+	t TINYINT,
+	s SMALLINT,
+	i INTEGER,
+	b BIGINT,
+	f FLOAT,
+	d DOUBLE,
+	dec18 DECIMAL(18, 3),
+	dt DATE,
+	ts DATETIME,
+	v VARCHAR(64),
+	bin VARBINARY(16)
+);
+INSERT INTO bench_wide
+WITH RECURSIVE seq(n) AS (SELECT 0 UNION ALL SELECT n + 1 FROM seq WHERE n < 999999)
+SELECT
+	n,
+	n % 100,
+	n % 30000,
+	n,
+	n * 1000003,
+	n / 7,
+	n / 13,
+	n / 1000,
+	DATE_ADD('2000-01-01', INTERVAL n % 10000 DAY),
+	DATE_ADD('2000-01-01 00:00:00', INTERVAL n SECOND),
+	CONCAT('value_', n),
+	UNHEX(LPAD(HEX(n), 16, '0'))
+FROM seq;
+
+-- a table of strings, with short and long values (one million rows)
+CREATE TABLE bench_strings(id BIGINT NOT NULL PRIMARY KEY, short_str VARCHAR(32), long_str TEXT);
+INSERT INTO bench_strings
+WITH RECURSIVE seq(n) AS (SELECT 0 UNION ALL SELECT n + 1 FROM seq WHERE n < 999999)
+SELECT n, CONCAT('str', n), REPEAT(CONCAT('long string ', n, ' '), 8) FROM seq;
+
+-- the target of the insert benchmarks
+CREATE TABLE bench_insert_target LIKE bench_wide;
+
+ANALYZE TABLE bench_narrow, bench_wide, bench_strings;
+
+-- a schema with 10,000 tables of 5 columns, used to benchmark loading the catalog
+DROP SCHEMA IF EXISTS mysqlbench_catalog;
+CREATE SCHEMA mysqlbench_catalog;
+
+DELIMITER //
+CREATE PROCEDURE create_catalog_tables()
+BEGIN
+	DECLARE n INT DEFAULT 0;
+	WHILE n < 10000 DO
+		SET @create_sql = CONCAT('CREATE TABLE mysqlbench_catalog.tbl_', n,
+		                         '(id BIGINT PRIMARY KEY, a INTEGER, b VARCHAR(100), c DOUBLE, d DATETIME)');
+		PREPARE stmt FROM @create_sql;
+		EXECUTE stmt;
+		DEALLOCATE PREPARE stmt;
+		SET n = n + 1;
+	END WHILE;
+END//
+DELIMITER ;
+
+CALL create_catalog_tables();
+DROP PROCEDURE create_catalog_tables;
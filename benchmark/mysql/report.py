@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+"""Summarizes the output of the benchmark runner as rows/s and MB/s
+
+Usage: build/release/benchmark/benchmark_runner 'benchmark/mysql/.*' 2>/dev/null | python3 benchmark/mysql/report.py
+
+The number of rows and bytes processed by each benchmark are taken from the "# rows:" and "# bytes:" headers of the
+benchmark files. The bytes are the size of the values as stored in DuckDB - not the number of bytes sent over the wire.
+"""
+import os
+import re
+import statistics
+import sys
+
+
+def read_header(path):
+    header = {}
+    with open(path) as f:
+        for line in f:
+            match = re.match(r'#\s*(rows|bytes):\s*(\d+)', line)
+            if match:
+                header[match.group(1)] = int(match.group(2))
+    return header
+
+
+def main():
+    timings = {}
+    for line in sys.stdin:
+        parts = line.strip().split('\t')
+        if len(parts) != 3 or not parts[0].endswith('.benchmark'):
+            continue
+        try:
+            timings.setdefault(parts[0], []).append(float(parts[2]))
+        except ValueError:
+            # e.g. a failed or timed out run
+            continue
+    if not timings:
+        print('No benchmark results found in the input', file=sys.stderr)
+        sys.exit(1)
+
+    print(f"{'benchmark':<55} {'median (s)':>12} {'rows/s':>14} {'MB/s':>10}")
+    for name in sorted(timings):
+        median = statistics.median(timings[name])
+        header = read_header(name) if os.path.exists(name) else {}
+        rows = header.get('rows', 0)
+        nbytes = header.get('bytes', 0)
+        rows_per_second = f'{rows / median:,.0f}' if rows and median > 0 else '-'
+        mb_per_second = f'{nbytes / median / 1e6:,.1f}' if nbytes and median > 0 else '-'
+        print(f'{name:<55} {median:>12.3f} {rows_per_second:>14} {mb_per_second:>10}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,21 @@
+#!/usr/bin/env bash
+# Starts a MySQL server in docker and loads the benchmark data
+# Usage: benchmark/mysql/setup.sh [mysql image, default mysql:8.4]
+set -euo pipefail
+
+IMAGE="${1:-mysql:8.4}"
+CONTAINER=duckdb-mysql-bench
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+
+docker rm -f "$CONTAINER" >/dev/null 2>&1 || true
+docker run -d --name "$CONTAINER" -p 3306:3306 -e MYSQL_ALLOW_EMPTY_PASSWORD=yes "$IMAGE" \
+	--local-infile=1 --max-allowed-packet=256M >/dev/null
+
+echo "Waiting for MySQL to start..."
+until docker exec "$CONTAINER" mysql -u root -e "SELECT 1" >/dev/null 2>&1; do
+	sleep 1
+done
+
+echo "Loading benchmark data..."
+docker exec -i "$CONTAINER" mysql -u root < "$SCRIPT_DIR/bench_data.sql"
+echo "Done - the benchmark data is available at host=127.0.0.1 port=3306 user=root database=mysqlbench"
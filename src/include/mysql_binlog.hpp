@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_binlog.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/map.hpp"
+
+namespace duckdb {
+
+//! A set of global transaction identifiers, e.g. "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5:7"
+//! This is used to track how far the binlog of a server has been read by mysql_binlog_scan
+class MySQLGtidSet {
+public:
+	//! Parses the text representation of a GTID set as used by MySQL (e.g. for @@global.gtid_executed)
+	static MySQLGtidSet Parse(const string &text);
+
+	void Add(const string &uuid, int64_t gno);
+	bool IsEmpty() const {
+		return intervals.empty();
+	}
+	//! Encodes the set in the binary format expected by the COM_BINLOG_DUMP_GTID command
+	string Encode() const;
+	string ToString() const;
+
+	//! Formats the 16 bytes of a server uuid as text
+	static string FormatUUID(const_data_ptr_t data);
+
+private:
+	void AddInterval(const string &uuid, int64_t start, int64_t end);
+
+private:
+	//! The (inclusive) intervals of transaction numbers - per (lower-case) server uuid
+	map<string, vector<pair<int64_t, int64_t>>> intervals;
+};
+
+} // namespace duckdb
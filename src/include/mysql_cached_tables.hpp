@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_cached_tables.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/shared_ptr.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class MySQLCatalog;
+class MySQLTableEntry;
+
+//! A group of consecutive rows of a cached table, together with the statistics of its columns - row groups that
+//! cannot hold rows matching the filters of a scan are skipped (as is done for the row groups of DuckDB tables)
+struct MySQLCachedRowGroup {
+	unique_ptr<ColumnDataCollection> rows;
+	vector<BaseStatistics> statistics;
+};
+
+//! The rows of a cached table as of a refresh - these are never modified once loaded, refreshes replace them
+struct MySQLCachedTableData {
+	static constexpr const idx_t ROW_GROUP_SIZE = 122880;
+
+	MySQLCachedTableData(vector<string> names_p, vector<LogicalType> types_p);
+
+	vector<string> names;
+	vector<LogicalType> types;
+	vector<MySQLCachedRowGroup> row_groups;
+	idx_t count = 0;
+
+	//! Appends rows, starting a new row group once the last row group is full
+	void Append(DataChunk &chunk);
+	//! Returns the highest value of a (numeric) column over all rows - or NULL if the column has no values
+	Value GetMaximum(idx_t column_index) const;
+	//! Returns the index of the column with the given name - or DConstants::INVALID_INDEX if there is no such column
+	idx_t GetColumnIndex(const string &name) const;
+};
+
+//! A table of an attached database that is kept as a local copy (see mysql_cache_table)
+class MySQLCachedTable : public enable_shared_from_this<MySQLCachedTable> {
+public:
+	MySQLCachedTable(string schema_name, string table_name, idx_t refresh_seconds, string watermark_column,
+	                 vector<string> primary_key);
+
+	const string schema_name;
+	const string table_name;
+	//! The number of seconds after which the copy is refreshed
+	const idx_t refresh_seconds;
+	//! If set, refreshes only read the rows from the highest value of this column onwards and replace the rows with the
+	//! same primary key - otherwise the table is read again if its checksum changed
+	const string watermark_column;
+	const vector<string> primary_key;
+
+public:
+	//! Returns the rows of the table - these are loaded first if they have been invalidated. Rows that are older than
+	//! the refresh interval are refreshed in the background while the previous rows are returned (see
+	//! mysql_cached_table_background_refresh) - or else before they are returned. While the table is being refreshed
+	//! by another query, the previous rows are returned.
+	shared_ptr<MySQLCachedTableData> GetData(ClientContext &context, MySQLCatalog &catalog);
+	//! Marks the rows as outdated (e.g. after the table has been written to) - they are reloaded when next used
+	void Invalidate();
+	//! Refreshes the rows on a background thread of the scheduler, through a connection of its own
+	void RefreshInBackground(DatabaseInstance &db, const string &catalog_name);
+
+private:
+	bool IsCurrent() const;
+	//! Schedules a refresh on a background thread - returns false if there are no background threads
+	bool ScheduleRefresh(ClientContext &context, MySQLCatalog &catalog);
+	//! Refreshes the rows - refresh_lock must be held
+	void Refresh(ClientContext &context, MySQLCatalog &catalog, bool full);
+	shared_ptr<MySQLCachedTableData> LoadRows(ClientContext &context, MySQLCatalog &catalog, const string &condition);
+	//! Replaces the rows that have changed - returns nullptr if the columns of the table have changed
+	shared_ptr<MySQLCachedTableData> MergeRows(MySQLCachedTableData &rows, MySQLCachedTableData &changed_rows);
+	string GetChecksum(ClientContext &context, MySQLCatalog &catalog);
+
+private:
+	//! Held while the table is refreshed - so that the table is refreshed by one query at a time
+	mutex refresh_lock;
+	mutex lock;
+	shared_ptr<MySQLCachedTableData> data;
+	std::chrono::steady_clock::time_point refreshed;
+	//! Set if the rows have to be read again entirely
+	bool invalidated = true;
+	//! Set while a refresh is scheduled on (or running on) a background thread
+	bool refresh_scheduled = false;
+	//! Incremented whenever the rows are invalidated - an invalidation during a refresh outlives the refresh
+	idx_t invalidations = 0;
+	//! The checksum of the table when it was last read (if watermark_column is not set)
+	string checksum;
+};
+
+//! The tables of an attached database that are cached locally, keyed by their (case-insensitive) table key
+class MySQLCachedTables {
+public:
+	//! Caches a table - replacing the cached copy (and configuration) if the table was cached before
+	void Add(shared_ptr<MySQLCachedTable> table);
+	//! Stops caching a table - returns false if the table was not cached
+	bool Remove(const string &schema_name, const string &table_name);
+	//! Returns the cached table - or nullptr if the table is not cached
+	shared_ptr<MySQLCachedTable> Find(const string &schema_name, const string &table_name);
+	//! Invalidates the copy of a table after it has been written to
+	void InvalidateTable(const string &schema_name, const string &table_name);
+	//! Invalidates the copies of all tables
+	void InvalidateAll();
+
+private:
+	mutex lock;
+	unordered_map<string, shared_ptr<MySQLCachedTable>> tables;
+};
+
+struct MySQLCachedScanBindData : public TableFunctionData {
+	MySQLCachedScanBindData(MySQLTableEntry &table, shared_ptr<MySQLCachedTableData> data_p);
+
+	MySQLTableEntry &table;
+	//! The rows that are scanned - a refresh during the scan does not affect them
+	shared_ptr<MySQLCachedTableData> data;
+	//! The column that is read as the row id (see MySQLTableEntry::GetRowIdColumn) - or INVALID_INDEX if it is NULL
+	idx_t row_id_index;
+};
+
+} // namespace duckdb
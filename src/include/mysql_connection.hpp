@@ -12,6 +12,7 @@
 #include "duckdb/common/mutex.hpp"
 #include "mysql_utils.hpp"
 #include "mysql_result.hpp"
+#include "mysql_statement.hpp"
 
 namespace duckdb {
 class MySQLBinaryWriter;
@@ -21,21 +22,6 @@ class MySQLSchemaEntry;
 class MySQLTableEntry;
 class MySQLStatement;
 class MySQLResult;
-struct IndexInfo;
-
-struct OwnedMySQLConnection {
-	explicit OwnedMySQLConnection(MYSQL *conn = nullptr) : connection(conn) {
-	}
-	~OwnedMySQLConnection() {
-		if (!connection) {
-			return;
-		}
-		mysql_close(connection);
-		connection = nullptr;
-	}
-
-	MYSQL *connection;
-};
 
 class MySQLConnection {
 public:
@@ -51,9 +37,37 @@ public:
 public:
 	static MySQLConnection Open(const string &connection_string);
 	void Execute(const string &query);
-	unique_ptr<MySQLResult> Query(const string &query, optional_ptr<ClientContext> context = nullptr);
+	//! Runs a query. If streaming is enabled rows are fetched from the server as they are read (mysql_use_result)
+	//! instead of being buffered in client memory first. While a streaming result is being read no other queries
+	//! can be issued over the connection - streaming results should only be used on dedicated connections
+	unique_ptr<MySQLResult> Query(const string &query, optional_ptr<ClientContext> context = nullptr,
+	                              bool streaming = false);
+	//! Runs several queries in a single round trip (as one multi-statement request), returning their results in order
+	//! The results are buffered in client memory. If any of the queries fails, the remaining queries are not run.
+	vector<unique_ptr<MySQLResult>> QueryMultiple(const vector<string> &queries);
+	//! Queues a statement that does not return a result (e.g. START TRANSACTION) to be sent together with the next
+	//! query over the connection, saving it a round trip of its own. Errors are reported by that next query.
+	void QueueStatement(string statement);
+	//! Sends any queued statements to the server
+	void FlushQueuedStatements();
+
+	//! Runs a query as a prepared statement, reading the result over the binary protocol as the provided types
+	//! The parameters are bound to the placeholders of the query. If cache_size is set, the statement is kept prepared
+	//! in the statement cache of the connection (of at most cache_size statements) to be re-used by the same query
+	unique_ptr<MySQLStatement> QueryPrepared(const string &query, const vector<LogicalType> &types,
+	                                         bool streaming = false, const vector<Value> &parameters = vector<Value>(),
+	                                         idx_t cache_size = 0);
+
+	//! Determines the result columns of a query without running it, by preparing it as a statement.
+	//! Returns false if the query cannot be prepared or does not return a result set.
+	bool TryGetQueryFields(ClientContext &context, const string &query, vector<MySQLField> &fields);
+
+	//! Runs a LOAD DATA LOCAL INFILE query, feeding the provided in-memory buffer to the server as the file contents.
+	//! Returns the number of loaded rows. Throws if the server reported any warnings while loading the data.
+	idx_t LoadData(const string &query, const_data_ptr_t data, idx_t size);
 
-	vector<IndexInfo> GetIndexInfo(const string &table_name);
+	//! Returns the server's @@max_allowed_packet - this is fetched once per connection
+	idx_t GetMaxAllowedPacket();
 
 	bool IsOpen();
 	void Close();
@@ -76,11 +90,18 @@ public:
 	static bool DebugPrintQueries();
 
 private:
-	MYSQL_RES *MySQLExecute(const string &query);
+	MYSQL_RES *MySQLExecute(const string &query, bool streaming);
+	//! Sends a query prefixed by any queued statements, and skips over the results of the queued statements
+	//! query_lock must be held
+	void SendQuery(MYSQL *con, const string &query);
+	unique_ptr<MySQLResult> MakeResult(MYSQL *con, MYSQL_RES *result, const string &query,
+	                                   optional_ptr<ClientContext> context, bool streaming);
 
 	mutex query_lock;
 	shared_ptr<OwnedMySQLConnection> connection;
 	string dsn;
+	//! Statements that are sent as a prefix of the next query
+	vector<string> queued_statements;
 };
 
 } // namespace duckdb
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_connection_pool.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "mysql_connection.hpp"
+
+namespace duckdb {
+
+struct MySQLConnectionPoolConfig {
+	//! Whether or not connections are pooled at all
+	bool enabled = true;
+	//! The number of idle connections that are kept open regardless of the idle timeout
+	idx_t min_size = 0;
+	//! The maximum number of idle connections that are kept open
+	idx_t max_size = 8;
+	//! The number of seconds after which idle connections (beyond min_size) are closed
+	idx_t idle_timeout = 300;
+
+	static MySQLConnectionPoolConfig FromContext(ClientContext &context);
+};
+
+//! Keeps idle connections to a MySQL server open so they can be reused, instead of connecting for every transaction
+class MySQLConnectionPool : public enable_shared_from_this<MySQLConnectionPool> {
+public:
+	explicit MySQLConnectionPool(string connection_string);
+
+	//! Borrows a connection - reusing a healthy idle connection if one is available, or opening a new one otherwise.
+	//! The settings of the context determine the configuration of the pool.
+	MySQLConnection Acquire(ClientContext &context);
+	//! Borrows a connection using the last known configuration of the pool
+	MySQLConnection Acquire();
+	//! Returns a connection to the pool. The connection must not be in the middle of a transaction or result.
+	void Release(MySQLConnection connection);
+	//! Closes all idle connections
+	void Clear();
+
+	const string &GetConnectionString() const {
+		return connection_string;
+	}
+
+private:
+	//! Idle connections are checked with mysql_ping if they have not been used for this many seconds
+	static constexpr const int64_t PING_AFTER_IDLE_SECONDS = 5;
+
+	struct IdleConnection {
+		MySQLConnection connection;
+		std::chrono::steady_clock::time_point idle_since;
+	};
+
+	void CloseExpiredConnections(std::chrono::steady_clock::time_point now);
+
+private:
+	string connection_string;
+	mutex lock;
+	MySQLConnectionPoolConfig config;
+	//! The idle connections - the most recently released connection is at the back
+	vector<IdleConnection> idle_connections;
+};
+
+} // namespace duckdb
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_decoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! Decodes a single (non-NULL) value sent over the text protocol into row "row" of the result vector
+typedef void (*mysql_decode_function_t)(const string_t &input, Vector &result, idx_t row);
+
+class MySQLDecoder {
+public:
+	//! Returns the function used to decode text-protocol values into the given type
+	//! If reference_strings is set, VARCHAR and BLOB values are not copied - the result vector then has to keep the
+	//! fetched rows alive (see StringVector::AddBuffer)
+	static mysql_decode_function_t GetDecodeFunction(const LogicalType &type, bool reference_strings = false);
+
+	//! Parses a decimal in the format MySQL sends them ([-]digits[.digits]) into its integer representation
+	template <class T>
+	static bool TryParseDecimal(const char *data, idx_t size, uint8_t scale, T &result) {
+		idx_t pos = 0;
+		bool negative = false;
+		if (pos < size && data[pos] == '-') {
+			negative = true;
+			pos++;
+		}
+		if (pos >= size) {
+			return false;
+		}
+		result = T(0);
+		idx_t fraction_digits = 0;
+		bool in_fraction = false;
+		for (; pos < size; pos++) {
+			auto c = data[pos];
+			if (c == '.' && !in_fraction) {
+				in_fraction = true;
+				continue;
+			}
+			if (c < '0' || c > '9') {
+				return false;
+			}
+			if (in_fraction) {
+				if (fraction_digits >= scale) {
+					// truncate any excess digits
+					continue;
+				}
+				fraction_digits++;
+			}
+			result = result * T(10) + T(c - '0');
+		}
+		for (; fraction_digits < scale; fraction_digits++) {
+			result = result * T(10);
+		}
+		if (negative) {
+			result = -result;
+		}
+		return true;
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_escape.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! Escaping and hex encoding of strings and blobs that are sent to MySQL - as literals in queries, or as the contents
+//! of LOAD DATA files. Bytes that need to be escaped are searched for 16 bytes at a time (with SSE2 on x86-64 and NEON
+//! on ARM64), so that the runs of bytes in between can be copied in bulk.
+class MySQLEscape {
+public:
+	//! Returns the offset of the first quote or backslash in the data - or size if there is none
+	static idx_t FindQuoted(const char *data, idx_t size, char quote);
+	//! Returns the offset of the first byte that has to be escaped in a LOAD DATA file (a backslash, NUL, newline,
+	//! carriage return or tab) - or size if there is none
+	static idx_t FindLoadData(const char *data, idx_t size);
+
+	//! Writes the data with quotes and backslashes escaped by a backslash into result - returns the written length
+	//! The result has to hold at least 2 * size bytes
+	static idx_t EscapeQuoted(const char *data, idx_t size, char quote, char *result);
+	//! Writes the data escaped as in a LOAD DATA file (with FIELDS ESCAPED BY '\\') into result - returns the written
+	//! length. The result has to hold at least 2 * size bytes
+	static idx_t EscapeLoadData(const char *data, idx_t size, char *result);
+	//! Writes the bytes as (upper case) hexadecimal digits into result, which has to hold 2 * size bytes
+	static void WriteHex(const_data_ptr_t data, idx_t size, char *result);
+
+	//! Returns the escape character that represents the (special) byte in a LOAD DATA file
+	static char GetLoadDataEscape(char c) {
+		switch (c) {
+		case '\0':
+			return '0';
+		case '\n':
+			return 'n';
+		case '\r':
+			return 'r';
+		case '\t':
+			return 't';
+		default:
+			return c;
+		}
+	}
+};
+
+} // namespace duckdb
@@ -11,19 +11,45 @@
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/expression.hpp"
 
 namespace duckdb {
+struct MySQLTablePartitions;
 
 class MySQLFilterPushdown {
 public:
+	//! Transforms the table filters into a MySQL condition. If parameters is set, the constants of the filters are
+	//! written as placeholders ("?") instead, and their values are added to parameters in order
 	static string TransformFilters(const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
-	                               const vector<string> &names);
+	                               const vector<string> &names, optional_ptr<vector<Value>> parameters = nullptr);
+	//! Returns the indexes of the partitions of a table that can hold rows matching the table filters - partitions that
+	//! cannot are pruned from the scan
+	static vector<idx_t> PrunePartitions(const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
+	                                     const vector<string> &names, const MySQLTablePartitions &partitions);
+	//! Transforms a filter expression over a scan into a MySQL condition - returns false if that is not possible
+	//! The condition always matches every row the expression matches. "exact" is set to false when it can match more
+	//! rows (e.g. because MySQL compares strings case-insensitively), in which case the expression has to be kept.
+	static bool TransformExpression(const Expression &expr, idx_t table_index, const vector<string> &column_names,
+	                                string &result, bool &exact);
+	//! Transforms a constant into a MySQL literal
+	static string TransformConstant(const Value &val);
+	//! Creates the condition of an incremental scan: the rows above the low watermark, up to and including the high
+	//! watermark. Watermarks are text as returned by MySQL - empty watermarks are unbounded.
+	static string TransformWatermark(const string &column_name, const LogicalType &type, const string &low_watermark,
+	                                 const string &high_watermark);
 
 private:
-	static string TransformFilter(string &column_name, TableFilter &filter);
+	//! Transforms a table filter into a MySQL condition - returns an empty string for skipped optional filters
+	static string TransformFilter(string &column_name, TableFilter &filter, optional_ptr<vector<Value>> parameters);
+	static string TransformParameter(const Value &val, optional_ptr<vector<Value>> parameters);
+	static bool IsSupportedFilter(const TableFilter &filter);
 	static string TransformComparison(ExpressionType type);
-	static string CreateExpression(string &column_name, vector<unique_ptr<TableFilter>> &filters, string op);
-	static string TransformConstant(const Value &val);
+	static string CreateExpression(string &column_name, vector<unique_ptr<TableFilter>> &filters, string op,
+	                               optional_ptr<vector<Value>> parameters);
+	static bool TransformComparisonExpression(const Expression &expr, idx_t table_index,
+	                                          const vector<string> &column_names, string &result, bool &exact);
+	static bool TransformFunctionExpression(const Expression &expr, idx_t table_index,
+	                                        const vector<string> &column_names, string &result, bool &exact);
 };
 
 } // namespace duckdb
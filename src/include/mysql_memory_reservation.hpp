@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_memory_reservation.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+class BufferManager;
+
+//! Accounts memory that is not allocated by DuckDB - such as results buffered by libmysql - against DuckDB's memory
+//! limit, by reserving it in the buffer pool. The memory is released again when the reservation is destroyed.
+class MySQLMemoryReservation {
+public:
+	MySQLMemoryReservation() = default;
+	explicit MySQLMemoryReservation(BufferManager &buffer_manager);
+	~MySQLMemoryReservation();
+	// disable copy constructors
+	MySQLMemoryReservation(const MySQLMemoryReservation &other) = delete;
+	MySQLMemoryReservation &operator=(const MySQLMemoryReservation &) = delete;
+	//! enable move constructors
+	MySQLMemoryReservation(MySQLMemoryReservation &&other) noexcept;
+	MySQLMemoryReservation &operator=(MySQLMemoryReservation &&) noexcept;
+
+public:
+	//! Changes the reserved size. Growing the reservation evicts DuckDB's own buffers if needed, and throws an
+	//! OutOfMemoryException if the memory limit would be exceeded - in which case the reservation is unchanged.
+	void Resize(idx_t new_size);
+	idx_t GetSize() const {
+		return size;
+	}
+
+private:
+	optional_ptr<BufferManager> buffer_manager;
+	idx_t size = 0;
+};
+
+} // namespace duckdb
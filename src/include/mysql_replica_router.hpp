@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_replica_router.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "mysql_connection_pool.hpp"
+
+namespace duckdb {
+
+enum class MySQLReplicaPolicy : uint8_t { ROUND_ROBIN, LEAST_LOADED };
+
+//! Routes read-only transactions to the read replicas of the server (the "replicas" connection option)
+//! Every transaction reads from a single replica, so that all of its scans see the same state of the data
+class MySQLReplicaRouter {
+public:
+	MySQLReplicaRouter(const string &connection_string, const MySQLConnectionParameters &parameters);
+
+	bool HasReplicas() const {
+		return !replicas.empty();
+	}
+	//! Chooses a replica for a transaction according to the policy, and borrows a connection from its pool.
+	//! Replicas that cannot be reached or lag behind by more than the maximum lag are skipped. Returns the index of
+	//! the chosen replica - or an invalid index if no replica is available, in which case the primary should be used.
+	optional_idx Acquire(ClientContext &context, MySQLConnection &connection);
+	//! Registers that a transaction that was routed to the replica has finished
+	void Finish(idx_t replica_index);
+	shared_ptr<MySQLConnectionPool> GetConnectionPool(idx_t replica_index);
+
+private:
+	//! An unavailable replica is skipped for this many seconds before it is tried again
+	static constexpr const int64_t RECHECK_SECONDS = 5;
+	//! The lag of a replica is checked at most this often
+	static constexpr const int64_t LAG_CHECK_SECONDS = 5;
+
+	struct MySQLReplica {
+		string name;
+		shared_ptr<MySQLConnectionPool> connection_pool;
+		//! The number of running transactions that read from the replica
+		idx_t active_transactions = 0;
+		bool available = true;
+		//! When the replica was last found to be unavailable, or had its lag checked
+		bool checked = false;
+		std::chrono::steady_clock::time_point checked_at;
+	};
+
+	//! Returns the replicas to try in order of preference - skipping replicas that were recently unavailable
+	vector<idx_t> GetCandidates(std::chrono::steady_clock::time_point now);
+	void SetAvailable(idx_t replica_index, bool available, std::chrono::steady_clock::time_point now);
+	bool NeedsLagCheck(idx_t replica_index, std::chrono::steady_clock::time_point now);
+
+private:
+	vector<MySQLReplica> replicas;
+	MySQLReplicaPolicy policy;
+	int64_t max_lag;
+	mutex lock;
+	//! The replica the next round-robin transaction starts at
+	idx_t next_replica = 0;
+};
+
+} // namespace duckdb
@@ -9,27 +9,53 @@
 #pragma once
 
 #include "mysql_utils.hpp"
+#include "mysql_memory_reservation.hpp"
 
 namespace duckdb {
 
 struct MySQLField {
 	string name;
 	LogicalType type;
+	//! The schema, table and column the field is read from - empty if the field is not read from a base table column
+	//! (e.g. for expressions, or for columns of views and derived tables)
+	string base_schema;
+	string base_table;
+	string base_column;
 };
 
 class MySQLResult {
 public:
-	MySQLResult(MYSQL_RES *res_p, idx_t field_count) : res(res_p), field_count(field_count) {
+	MySQLResult(MYSQL_RES *res_p, idx_t field_count, shared_ptr<OwnedMySQLConnection> streaming_connection_p = nullptr)
+	    : res(res_p), field_count(field_count), streaming_connection(std::move(streaming_connection_p)) {
 	}
-	MySQLResult(MYSQL_RES *res_p, vector<MySQLField> fields_p)
-	    : res(res_p), field_count(fields_p.size()), fields(std::move(fields_p)) {
+	MySQLResult(MYSQL_RES *res_p, vector<MySQLField> fields_p,
+	            shared_ptr<OwnedMySQLConnection> streaming_connection_p = nullptr)
+	    : res(res_p), field_count(fields_p.size()), fields(std::move(fields_p)),
+	      streaming_connection(std::move(streaming_connection_p)) {
 	}
 	MySQLResult(idx_t affected_rows) : affected_rows(affected_rows) {
 	}
 	~MySQLResult() {
-		if (res) {
+		if (!res) {
+			return;
+		}
+		if (!streaming_connection || exhausted) {
+			mysql_free_result(res);
+			return;
+		}
+		if (!streaming_connection->connection) {
+			// the connection has been closed already - detach the result, which would otherwise be flushed through it
+			res->handle = nullptr;
 			mysql_free_result(res);
+			return;
 		}
+		// freeing a partially read streaming result fetches (and discards) all remaining rows - cancel the query on
+		// the server first, so that only the rows that are already on their way are discarded
+		streaming_connection->CancelQuery();
+		// the result is freed while the connection is still open, as freeing it flushes it through the connection
+		mysql_free_result(res);
+		// the connection is not reused - it has received the error of the cancelled query
+		streaming_connection->Close();
 	}
 
 public:
@@ -59,6 +85,14 @@ public:
 		}
 		mysql_row = mysql_fetch_row(res);
 		lengths = mysql_fetch_lengths(res);
+		if (!mysql_row) {
+			exhausted = true;
+			if (streaming_connection && streaming_connection->connection &&
+			    mysql_errno(streaming_connection->connection) != 0) {
+				// for streaming results errors can occur while fetching
+				throw IOException("Failed to fetch row from MySQL: %s", mysql_error(streaming_connection->connection));
+			}
+		}
 		return mysql_row;
 	}
 	idx_t AffectedRows() {
@@ -74,6 +108,31 @@ public:
 	const vector<MySQLField> &Fields() {
 		return fields;
 	}
+	//! Whether or not rows are fetched from the server as they are read
+	bool IsStreaming() const {
+		return streaming_connection != nullptr;
+	}
+	//! Returns the (approximate) client memory held by a buffered result - this has to be called before reading rows
+	idx_t GetBufferedSize() {
+		if (!res || IsStreaming()) {
+			return 0;
+		}
+		// every row is stored as a MYSQL_ROWS entry holding an array of pointers into the null-terminated values
+		auto row_count = mysql_num_rows(res);
+		idx_t size = row_count * (sizeof(MYSQL_ROWS) + (field_count + 1) * sizeof(char *));
+		while (mysql_fetch_row(res)) {
+			auto row_lengths = mysql_fetch_lengths(res);
+			for (idx_t c = 0; c < field_count; c++) {
+				size += row_lengths[c] + 1;
+			}
+		}
+		mysql_data_seek(res, 0);
+		return size;
+	}
+	//! Keeps the memory of the result reserved in DuckDB's buffer pool until the result is destroyed
+	void SetReservation(MySQLMemoryReservation reservation_p) {
+		reservation = std::move(reservation_p);
+	}
 
 private:
 	MYSQL_RES *res = nullptr;
@@ -82,6 +141,11 @@ private:
 	unsigned long *lengths = nullptr;
 	idx_t field_count = 0;
 	vector<MySQLField> fields;
+	//! The connection over which rows are fetched (streaming results only)
+	shared_ptr<OwnedMySQLConnection> streaming_connection;
+	bool exhausted = false;
+	//! The memory of a buffered result that is accounted against DuckDB's memory limit
+	MySQLMemoryReservation reservation;
 
 	char *GetNonNullValue(idx_t col) {
 		auto val = GetValueInternal(col);
@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+
+namespace duckdb {
+class ClientContext;
+
+struct MySQLResultCacheConfig {
+	//! The number of seconds for which results are cached - or 0 if results are not cached
+	idx_t ttl = 0;
+	//! The maximum total size in bytes of all cached results
+	idx_t max_bytes = 268435456;
+
+	bool Enabled() const {
+		return ttl > 0 && max_bytes > 0;
+	}
+
+	static MySQLResultCacheConfig FromContext(ClientContext &context);
+};
+
+//! A fully read result of a query
+struct MySQLCachedResult {
+	MySQLCachedResult(vector<string> names_p, vector<LogicalType> types_p);
+
+	vector<string> names;
+	vector<LogicalType> types;
+	unique_ptr<ColumnDataCollection> collection;
+};
+
+//! Caches the results of queries run against a MySQL database, keyed by the query text
+class MySQLResultCache {
+public:
+	//! Returns the cached result of the query - or nullptr if it is not cached or has been cached longer than the ttl
+	shared_ptr<MySQLCachedResult> Lookup(const string &query, const MySQLResultCacheConfig &config);
+	//! Caches the result of a query. The table is the qualified name of the table the result was read from, or empty
+	//! if it is unknown (e.g. for mysql_query) - in which case the result is invalidated by writes to any table.
+	//! Least recently used results are evicted to stay within the configured size.
+	void Store(const string &query, const string &table, shared_ptr<MySQLCachedResult> result,
+	           const MySQLResultCacheConfig &config);
+	//! Invalidates all results that (may) have been read from the given table
+	void InvalidateTable(const string &table);
+	//! Invalidates all results
+	void Clear();
+
+	//! The (case-insensitive) key of a table used for invalidation
+	static string GetTableKey(const string &schema_name, const string &table_name);
+
+private:
+	struct CachedEntry {
+		shared_ptr<MySQLCachedResult> result;
+		string table;
+		idx_t size = 0;
+		std::chrono::steady_clock::time_point created;
+		idx_t last_used = 0;
+	};
+
+	void EraseEntry(unordered_map<string, CachedEntry>::iterator entry);
+
+private:
+	mutex lock;
+	unordered_map<string, CachedEntry> entries;
+	//! The total size in bytes of all cached results
+	idx_t total_size = 0;
+	//! Incremented on every use - used to find the least recently used result
+	idx_t use_counter = 0;
+};
+
+} // namespace duckdb
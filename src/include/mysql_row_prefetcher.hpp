@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_row_prefetcher.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "mysql_result.hpp"
+#include "mysql_memory_reservation.hpp"
+#include <condition_variable>
+#include <deque>
+
+namespace duckdb {
+
+//! A batch of rows copied out of a result
+struct MySQLRowBatch {
+	explicit MySQLRowBatch(idx_t column_count) : column_count(column_count) {
+	}
+
+	idx_t column_count;
+	idx_t row_count = 0;
+	//! The values of all rows, concatenated
+	vector<char> data;
+	//! The offset of every value in data
+	vector<idx_t> offsets;
+	//! The length of every value - or DConstants::INVALID_INDEX for NULL values
+	vector<idx_t> lengths;
+	//! The memory of the batch that is accounted against DuckDB's memory limit - released with the batch
+	MySQLMemoryReservation reservation;
+
+	void AppendRow(MySQLResult &result);
+	idx_t MemorySize() const {
+		return data.capacity() + (offsets.capacity() + lengths.capacity()) * sizeof(idx_t);
+	}
+
+	bool IsNull(idx_t row, idx_t col) const {
+		return lengths[row * column_count + col] == DConstants::INVALID_INDEX;
+	}
+	string_t GetStringT(idx_t row, idx_t col) const {
+		auto idx = row * column_count + col;
+		return string_t(data.data() + offsets[idx], UnsafeNumericCast<uint32_t>(lengths[idx]));
+	}
+};
+
+//! Fetches the rows of a streaming result on a background thread - so that the next rows are transferred over the
+//! network while the previous rows are decoded
+class MySQLRowPrefetcher {
+public:
+	//! If a buffer manager is provided, the memory of the fetched batches is reserved in DuckDB's buffer pool
+	MySQLRowPrefetcher(unique_ptr<MySQLResult> result, idx_t column_count,
+	                   optional_ptr<BufferManager> buffer_manager = nullptr);
+	~MySQLRowPrefetcher();
+
+	//! Returns the next batch of rows, or nullptr if all rows have been read. Rethrows errors raised while fetching.
+	unique_ptr<MySQLRowBatch> NextBatch();
+
+private:
+	//! The number of fetched batches that can be waiting to be decoded
+	static constexpr const idx_t MAX_PENDING_BATCHES = 2;
+	//! Batches are cut short once they hold this many bytes - so that wide rows (e.g. large BLOBs) do not pile up
+	static constexpr const idx_t MAX_BATCH_BYTES = 16ULL * 1024ULL * 1024ULL;
+
+	void FetchRows();
+
+private:
+	unique_ptr<MySQLResult> result;
+	idx_t column_count;
+	optional_ptr<BufferManager> buffer_manager;
+	mutex lock;
+	std::condition_variable batch_event;
+	std::deque<unique_ptr<MySQLRowBatch>> batches;
+	//! Whether or not all rows have been fetched (or fetching failed)
+	bool finished = false;
+	ErrorData error;
+	//! Set when the prefetcher is destroyed before all rows have been read
+	atomic<bool> cancelled;
+	thread fetch_thread;
+};
+
+} // namespace duckdb
@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_scan_stats.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/insertion_order_preserving_map.hpp"
+
+namespace duckdb {
+
+//! The counters of a single scan or insert - updated concurrently by the threads of the operator
+struct MySQLOperatorStats {
+	//! The attached database the operator reads from or writes to
+	string database_name;
+	//! The kind of operator - "scan", "query", "insert" or "create_table_as"
+	string operator_name;
+	//! The table that is scanned or inserted into - or the query that is run
+	string target;
+	//! Whether or not the time spent fetching rows is measured separately from the time spent decoding them
+	//! This is only done when profiling is enabled, as it requires timing every row of text-protocol scans
+	bool detailed = false;
+
+	//! The number of statements sent to the server
+	atomic<idx_t> statements {0};
+	atomic<idx_t> rows {0};
+	//! The number of bytes of values received from (or sent to) the server
+	atomic<idx_t> bytes {0};
+	//! The time spent running the statements - until their first rows are available for streaming results, and until
+	//! all of their rows have been received for buffered results (which are transferred before they are returned)
+	atomic<int64_t> query_micros {0};
+	//! The time spent waiting for rows to be fetched from the server - includes decoding unless detailed is set
+	atomic<int64_t> fetch_micros {0};
+	//! The time spent decoding fetched values into vectors (only if detailed is set)
+	atomic<int64_t> decode_micros {0};
+
+	static int64_t ElapsedMicros(std::chrono::steady_clock::time_point start) {
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	}
+
+	//! Formats the counters for the EXPLAIN ANALYZE output
+	InsertionOrderPreservingMap<string> ToString() const;
+};
+
+//! A finished scan or insert, as reported by mysql_scan_stats()
+struct MySQLOperatorStatsEntry {
+	string database_name;
+	string operator_name;
+	string target;
+	bool detailed;
+	idx_t statements;
+	idx_t rows;
+	idx_t bytes;
+	int64_t query_micros;
+	int64_t fetch_micros;
+	int64_t decode_micros;
+};
+
+//! Keeps the statistics of the most recently finished operators of an attached database
+class MySQLStatsLog {
+public:
+	//! The number of finished operators that are remembered
+	static constexpr const idx_t MAX_ENTRIES = 1000;
+
+	void Record(const MySQLOperatorStats &stats);
+	vector<MySQLOperatorStatsEntry> GetEntries();
+	void Clear();
+
+private:
+	mutex lock;
+	deque<MySQLOperatorStatsEntry> entries;
+};
+
+} // namespace duckdb
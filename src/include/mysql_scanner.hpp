@@ -9,11 +9,15 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "duckdb/function/function_set.hpp"
+#include "duckdb/function/copy_function.hpp"
+#include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "mysql_utils.hpp"
 #include "mysql_connection.hpp"
+#include "storage/mysql_table_entry.hpp"
 
 namespace duckdb {
-class MySQLTableEntry;
 class MySQLTransaction;
 
 struct MySQLBindData : public FunctionData {
@@ -24,7 +28,35 @@ struct MySQLBindData : public FunctionData {
 	vector<MySQLType> mysql_types;
 	vector<string> names;
 	vector<LogicalType> types;
+	//! Conditions of filter expressions that have been pushed into the scan (if any)
+	string filter;
+	//! The conditions of the filter expressions that were pushed into the scan before the join order was chosen - used
+	//! to estimate the cardinality of the scan (see mysql_explain_cardinality)
+	string estimate_filter;
+	//! Whether or not a sample has been pushed into the scan - the rows that are read are chosen randomly by MySQL
+	bool sampled = false;
+	//! Whether or not the pushed down sample has a seed (REPEATABLE) - the random sequence of a seed restarts in every
+	//! statement, so such scans are read through a single statement rather than split into parallel partitions
+	bool seeded_sample = false;
+	//! The pushed down ORDER BY clause (if any)
+	string order_by;
+	//! Set if the scan reads the table in primary key order in place of an ORDER BY in DuckDB - the rows (and the
+	//! partitions of parallel scans) then have to be emitted in that order
+	OrderType primary_key_order = OrderType::INVALID;
 	string limit;
+	//! The maximum number of rows returned through the pushed down LIMIT clause (if any)
+	optional_idx limit_rows;
+	//! If set, the query that is run instead of scanning the table (e.g. a pushed down aggregate)
+	string query;
+	//! The (monotonically increasing) column of an incremental scan - only rows above the low watermark are read
+	string watermark_column;
+	//! The name under which the high watermark of an incremental scan is recorded
+	string watermark_name;
+	//! The low watermark of an incremental scan - empty to read all rows
+	string low_watermark;
+	//! The partitions of the table, as read when the scan was bound - only set for partitioned tables if partition
+	//! scans are enabled (see mysql_partition_scan)
+	unique_ptr<MySQLTablePartitions> partitions;
 
 public:
 	unique_ptr<FunctionData> Copy() const override {
@@ -45,10 +77,22 @@ public:
 	MySQLQueryFunction();
 };
 
+class MySQLScanIncrementalFunction : public TableFunction {
+public:
+	MySQLScanIncrementalFunction();
+};
+
+class MySQLBinlogScanFunction : public TableFunction {
+public:
+	MySQLBinlogScanFunction();
+};
+
 class MySQLClearCacheFunction : public TableFunction {
 public:
 	MySQLClearCacheFunction();
 
+	//! mysql_clear_cache() and mysql_clear_cache('database[.schema[.table]]')
+	static TableFunctionSet GetFunctionSet();
 	static void ClearCacheOnSetting(ClientContext &context, SetScope scope, Value &parameter);
 };
 
@@ -57,4 +101,37 @@ public:
 	MySQLExecuteFunction();
 };
 
+class MySQLScanStatsFunction : public TableFunction {
+public:
+	MySQLScanStatsFunction();
+};
+
+class MySQLWatermarksFunction : public TableFunction {
+public:
+	MySQLWatermarksFunction();
+};
+
+//! mysql_cache_table('database[.schema].table', refresh := INTERVAL, watermark := VARCHAR)
+class MySQLCacheTableFunction : public TableFunction {
+public:
+	MySQLCacheTableFunction();
+};
+
+class MySQLUncacheTableFunction : public TableFunction {
+public:
+	MySQLUncacheTableFunction();
+};
+
+//! Scans the local copy of a cached table - replaces scans of cached tables in the optimizer
+class MySQLCachedScanFunction : public TableFunction {
+public:
+	MySQLCachedScanFunction();
+};
+
+//! COPY ... TO 'database[.schema].table' (FORMAT mysql) - loads rows into a MySQL table through LOAD DATA
+class MySQLCopyFunction : public CopyFunction {
+public:
+	MySQLCopyFunction();
+};
+
 } // namespace duckdb
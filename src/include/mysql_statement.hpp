@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_statement.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "mysql_utils.hpp"
+
+namespace duckdb {
+
+//! The fetch buffers of a single result column of a prepared statement
+struct MySQLStatementColumn {
+	LogicalType type;
+	int64_t int_value = 0;
+	float float_value = 0;
+	double double_value = 0;
+	MYSQL_TIME time_value;
+	vector<char> string_buffer;
+	unsigned long length = 0;
+	bool is_null = false;
+	bool error = false;
+};
+
+//! The value of a parameter of a prepared statement
+struct MySQLStatementParameter {
+	int64_t int_value = 0;
+	double double_value = 0;
+	string string_value;
+};
+
+//! A prepared statement whose result is read over the binary protocol - values are fetched directly into typed
+//! buffers instead of being sent as text
+class MySQLStatement {
+public:
+	MySQLStatement(shared_ptr<OwnedMySQLConnection> connection, MYSQL_STMT *stmt, string query);
+	~MySQLStatement();
+	// disable copy constructors
+	MySQLStatement(const MySQLStatement &other) = delete;
+	MySQLStatement &operator=(const MySQLStatement &) = delete;
+
+public:
+	//! Executes the statement with the provided parameters, reading the result as the provided types
+	void Execute(const vector<LogicalType> &types, bool streaming, const vector<Value> &parameters = vector<Value>());
+	//! Keeps the statement prepared after use, by returning it to the statement cache of the connection
+	void KeepPrepared(idx_t cache_size_p) {
+		cache_size = cache_size_p;
+	}
+	//! Fetches up to STANDARD_VECTOR_SIZE rows into the output chunk - returns the number of rows fetched
+	idx_t Fetch(DataChunk &output);
+	//! The total size of the (non-NULL) values fetched so far
+	idx_t BytesFetched() const {
+		return bytes_fetched;
+	}
+
+private:
+	void BindParameters(const vector<Value> &parameters);
+	void BindColumn(idx_t col_idx, MYSQL_FIELD *field);
+	void FetchString(idx_t col_idx);
+	void WriteValue(idx_t col_idx, Vector &result, idx_t row);
+
+private:
+	shared_ptr<OwnedMySQLConnection> connection;
+	MYSQL_STMT *stmt;
+	string query;
+	vector<MySQLStatementColumn> columns;
+	vector<MYSQL_BIND> binds;
+	vector<MySQLStatementParameter> param_values;
+	vector<MYSQL_BIND> param_binds;
+	bool streaming = false;
+	bool rebind_required = false;
+	bool exhausted = false;
+	idx_t bytes_fetched = 0;
+	//! The capacity of the statement cache the statement is returned to after use (0 to close the statement)
+	idx_t cache_size = 0;
+	//! Whether or not the statement has been executed successfully - failed statements are not re-used
+	bool executed = false;
+};
+
+} // namespace duckdb
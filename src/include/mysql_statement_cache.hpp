@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_statement_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "mysql.h"
+
+namespace duckdb {
+
+//! The prepared statements of a single connection, keyed by their query text - with filter constants sent as
+//! parameters, repeated scans of the same shape (e.g. point lookups) skip parsing and preparing on the server
+//! Statements are taken out of the cache while they are used, so a statement is never used by two scans at once
+class MySQLStatementCache {
+public:
+	~MySQLStatementCache();
+
+	//! Takes the prepared statement of the query out of the cache - returns nullptr if there is none
+	MYSQL_STMT *Take(const string &query);
+	//! Puts a statement (back) into the cache - closing the least recently used statements beyond the capacity
+	void Return(const string &query, MYSQL_STMT *stmt, idx_t capacity);
+	//! Closes all cached statements
+	void Clear();
+	idx_t Count();
+
+private:
+	mutex lock;
+	//! The cached statements, the most recently used first
+	list<pair<string, MYSQL_STMT *>> statements;
+	unordered_map<string, list<pair<string, MYSQL_STMT *>>::iterator> statement_map;
+};
+
+} // namespace duckdb
@@ -11,58 +11,54 @@
 #include "duckdb.hpp"
 #include "duckdb/common/types/interval.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "mysql_escape.hpp"
 
 namespace duckdb {
 
+//! Writes rows in the default format of LOAD DATA, i.e.
+//! FIELDS TERMINATED BY '\t' ESCAPED BY '\\' LINES TERMINATED BY '\n'
 class MySQLTextWriter {
 public:
 	void WriteNull() {
-		stream.WriteData(const_data_ptr_cast("\b"), 1);
+		stream.WriteData(const_data_ptr_cast("\\N"), 2);
 	}
 
 	void WriteChar(char c) {
-		switch (c) {
-		case '\n':
-			WriteChar('\\');
-			WriteChar('n');
-			break;
-		case '\r':
-			WriteChar('\\');
-			WriteChar('r');
-			break;
-		case '\b':
-			WriteChar('\\');
-			WriteChar('b');
-			break;
-		case '\f':
-			WriteChar('\\');
-			WriteChar('f');
-			break;
-		case '\t':
-			WriteChar('\\');
-			WriteChar('t');
-			break;
-		case '\v':
-			WriteChar('\\');
-			WriteChar('v');
-			break;
-		default:
+		if (c == '\\' || c == '\0' || c == '\n' || c == '\r' || c == '\t') {
+			WriteEscaped(MySQLEscape::GetLoadDataEscape(c));
+		} else {
 			stream.WriteData(const_data_ptr_cast(&c), 1);
-			break;
 		}
 	}
 
 	void WriteVarchar(string_t value) {
 		auto size = value.GetSize();
 		auto data = value.GetData();
-		for (idx_t c = 0; c < size; c++) {
-			WriteChar(data[c]);
+		idx_t i = 0;
+		while (i < size) {
+			// copy the runs of bytes that do not need to be escaped in bulk
+			auto next = i + MySQLEscape::FindLoadData(data + i, size - i);
+			if (next > i) {
+				stream.WriteData(const_data_ptr_cast(data + i), next - i);
+			}
+			if (next == size) {
+				break;
+			}
+			WriteEscaped(MySQLEscape::GetLoadDataEscape(data[next]));
+			i = next + 1;
 		}
 	}
 
+	//! Writes text that contains no characters that need to be escaped (e.g. a formatted number)
+	void WriteRaw(const char *data, idx_t size) {
+		stream.WriteData(const_data_ptr_cast(data), size);
+	}
+
+	//! Writes a value of a VARCHAR or BLOB column - blobs are written as their (escaped) raw bytes
 	void WriteValue(Vector &col, idx_t r) {
-		if (col.GetType().id() != LogicalTypeId::VARCHAR) {
-			throw InternalException("Text format can only write VARCHAR columns");
+		auto type_id = col.GetType().id();
+		if (type_id != LogicalTypeId::VARCHAR && type_id != LogicalTypeId::BLOB) {
+			throw InternalException("Text format can only write VARCHAR or BLOB columns");
 		}
 		if (FlatVector::IsNull(col, r)) {
 			WriteNull();
@@ -79,8 +75,18 @@ public:
 		stream.WriteData(const_data_ptr_cast("\n"), 1);
 	}
 
-	void WriteFooter() {
-		stream.WriteData(const_data_ptr_cast("\\.\n"), 3);
+	idx_t Size() {
+		return stream.GetPosition();
+	}
+
+	void Reset() {
+		stream.Rewind();
+	}
+
+private:
+	void WriteEscaped(char c) {
+		char escaped[2] = {'\\', c};
+		stream.WriteData(const_data_ptr_cast(escaped), 2);
 	}
 
 public:
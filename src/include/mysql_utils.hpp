@@ -10,10 +10,41 @@
 
 #include "duckdb.hpp"
 #include "mysql.h"
+#include "mysql_statement_cache.hpp"
 
 namespace duckdb {
 class MySQLSchemaEntry;
 class MySQLTransaction;
+class MySQLConnectionPool;
+
+struct OwnedMySQLConnection {
+	explicit OwnedMySQLConnection(MYSQL *conn = nullptr) : connection(conn) {
+	}
+	~OwnedMySQLConnection() {
+		Close();
+	}
+
+	void Close() {
+		if (!connection) {
+			return;
+		}
+		mysql_close(connection);
+		// closing the connection detaches its prepared statements - so they are freed without contacting the server
+		statement_cache.Clear();
+		connection = nullptr;
+	}
+	//! Cancels the query that is running over the connection (with KILL QUERY), through a connection of the pool the
+	//! connection was opened by - does nothing if the connection was not opened by a pool
+	void CancelQuery();
+
+	MYSQL *connection;
+	//! The pool the connection was opened by (if any)
+	weak_ptr<MySQLConnectionPool> pool;
+	//! The server's @@max_allowed_packet (0 if not yet fetched)
+	idx_t max_allowed_packet = 0;
+	//! The prepared statements that are kept for re-use on this connection
+	MySQLStatementCache statement_cache;
+};
 
 struct MySQLTypeData {
 	string type_name;
@@ -38,6 +69,10 @@ struct MySQLConnectionParameters {
 	uint32_t port = 0;
 	string unix_socket;
 	idx_t client_flag = CLIENT_COMPRESS | CLIENT_IGNORE_SIGPIPE | CLIENT_MULTI_STATEMENTS;
+	//! The permitted compression algorithms in order of preference (e.g. "zstd,zlib") - overrides compress if set
+	string compression_algorithms;
+	//! The zstd compression level (1-22), or 0 to use the default level
+	uint32_t zstd_compression_level = 0;
 	unsigned int ssl_mode = SSL_MODE_PREFERRED;
 	string ssl_ca;
 	string ssl_ca_path;
@@ -46,6 +81,12 @@ struct MySQLConnectionParameters {
 	string ssl_crl;
 	string ssl_crl_path;
 	string ssl_key;
+	//! The read replicas of the server as host[:port] - read-only transactions are routed to these
+	vector<string> replicas;
+	//! How a replica is chosen for a transaction - "round_robin" or "least_loaded"
+	string replica_policy = "round_robin";
+	//! Replicas that lag behind the primary by more than this many seconds are skipped, or -1 to not check the lag
+	int64_t replica_max_lag = -1;
 };
 
 class MySQLUtils {
@@ -55,7 +96,7 @@ public:
 
 	static LogicalType ToMySQLType(const LogicalType &input);
 	static LogicalType TypeToLogicalType(ClientContext &context, const MySQLTypeData &input);
-	static LogicalType FieldToLogicalType(ClientContext &context, MYSQL_FIELD *field);
+	static LogicalType FieldToLogicalType(ClientContext &context, MYSQL_FIELD *field, bool streaming = false);
 	static string TypeToString(const LogicalType &input);
 
 	static string WriteIdentifier(const string &identifier);
@@ -0,0 +1,30 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// mysql_watermarks.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The high watermarks recorded by the incremental scans (mysql_scan_incremental) of an attached database
+//! Watermarks are kept as the text MySQL returns for the watermark column, so they can be compared without conversion
+class MySQLWatermarks {
+public:
+	//! Looks up the watermark with the given name - returns false if no watermark has been recorded under that name
+	bool TryGet(const string &name, string &watermark);
+	void Set(const string &name, string watermark);
+	map<string, string> GetAll();
+
+private:
+	mutex lock;
+	map<string, string> watermarks;
+};
+
+} // namespace duckdb
@@ -9,8 +9,15 @@
 #pragma once
 
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "mysql_cached_tables.hpp"
 #include "mysql_connection.hpp"
+#include "mysql_connection_pool.hpp"
+#include "mysql_replica_router.hpp"
+#include "mysql_result_cache.hpp"
+#include "mysql_scan_stats.hpp"
+#include "mysql_watermarks.hpp"
 #include "storage/mysql_schema_set.hpp"
 
 namespace duckdb {
@@ -24,6 +31,8 @@ public:
 	string connection_string;
 	string attach_path;
 	AccessMode access_mode;
+	//! Set when the cache is cleared - the persistent schema cache is then refreshed from the server
+	atomic<bool> schema_cache_invalidated;
 
 public:
 	void Initialize(bool load_builtin) override;
@@ -59,6 +68,36 @@ public:
 	string GetDBPath() override;
 
 	void ClearCache();
+	//! Clears the cached schema information of a single schema - or of a single table of the schema if table_name is
+	//! set. Other schemas and tables are not reloaded.
+	void ClearCache(const string &schema_name, const string &table_name = string());
+	//! Whether or not the persistent schema cache of the schema has to be refreshed from the server
+	bool SchemaCacheInvalidated(const string &schema_name);
+
+	MySQLConnectionPool &GetConnectionPool() {
+		return *connection_pool;
+	}
+	shared_ptr<MySQLConnectionPool> GetConnectionPoolPtr() {
+		return connection_pool;
+	}
+	MySQLReplicaRouter &GetReplicaRouter() {
+		return *replica_router;
+	}
+	MySQLResultCache &GetResultCache() {
+		return result_cache;
+	}
+	MySQLStatsLog &GetStatsLog() {
+		return stats_log;
+	}
+	MySQLWatermarks &GetWatermarks() {
+		return watermarks;
+	}
+	MySQLCachedTables &GetCachedTables() {
+		return cached_tables;
+	}
+	//! Fetches the columns of a schema that were loaded together with the other schemas listed by a schema scan -
+	//! returns false if the columns of the schema have not been (and will not be) prefetched
+	bool TryGetPrefetchedColumns(ClientContext &context, const string &schema_name, vector<MySQLColumnInfo> &columns);
 
 private:
 	void DropSchema(ClientContext &context, DropInfo &info) override;
@@ -66,6 +105,26 @@ private:
 private:
 	MySQLSchemaSet schemas;
 	string default_schema;
+	//! The idle connections to the server - shared with the transactions that borrow them
+	shared_ptr<MySQLConnectionPool> connection_pool;
+	//! Routes read-only transactions to the read replicas of the server (if any are configured)
+	unique_ptr<MySQLReplicaRouter> replica_router;
+	//! The cached results of queries (if enabled through mysql_result_cache_ttl)
+	MySQLResultCache result_cache;
+	//! The statistics of recently finished scans and inserts (see mysql_scan_stats)
+	MySQLStatsLog stats_log;
+	//! The high watermarks recorded by incremental scans (see mysql_scan_incremental)
+	MySQLWatermarks watermarks;
+	//! The tables that are kept as local copies (see mysql_cache_table)
+	MySQLCachedTables cached_tables;
+	mutex invalidated_schemas_lock;
+	//! The schemas that were cleared individually - their persistent schema cache is refreshed from the server
+	case_insensitive_set_t invalidated_schemas;
+	mutex prefetch_lock;
+	//! The schemas whose tables have not been loaded yet - armed while a schema scan lists the tables of all schemas
+	vector<string> prefetch_schemas;
+	//! The columns of the schemas that were loaded in a single query, but not yet consumed by their table set
+	unordered_map<string, vector<MySQLColumnInfo>> prefetched_columns;
 };
 
 } // namespace duckdb
@@ -11,6 +11,8 @@
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/atomic.hpp"
+#include <condition_variable>
 
 namespace duckdb {
 struct DropInfo;
@@ -26,9 +28,30 @@ public:
 	void Scan(ClientContext &context, const std::function<void(CatalogEntry &)> &callback);
 	virtual optional_ptr<CatalogEntry> CreateEntry(unique_ptr<CatalogEntry> entry);
 	void ClearEntries();
+	//! Removes a single entry from the set, so that it is reloaded from the server the next time it is used
+	//! Sets that cannot load single entries are cleared entirely instead
+	void InvalidateEntry(const string &name);
+	//! Returns the entry if it has already been loaded - without loading anything from the server
+	optional_ptr<CatalogEntry> GetLoadedEntry(const string &name);
+	//! Calls the callback for the entries that have already been loaded - without loading anything from the server
+	void ScanLoadedEntries(const std::function<void(CatalogEntry &)> &callback);
+	//! Whether or not all entries of the set have been loaded
+	bool IsLoaded() const {
+		return is_loaded;
+	}
 
 protected:
 	virtual void LoadEntries(ClientContext &context) = 0;
+	//! Loads a single entry without loading the entire set - returns nullptr if the entry does not exist
+	//! Only called in lazy mode (mysql_lazy_schema_loading) for sets that support it
+	virtual optional_ptr<CatalogEntry> LoadEntry(ClientContext &context, const string &name);
+	virtual bool SupportsLazyLoading() const {
+		return false;
+	}
+	//! Whether or not LoadEntry is implemented, so that single entries can be reloaded after they are invalidated
+	virtual bool SupportsLoadingEntries() const {
+		return SupportsLazyLoading();
+	}
 
 	void EraseEntryInternal(const string &name);
 
@@ -36,9 +59,32 @@ protected:
 	Catalog &catalog;
 
 private:
-	mutex entry_lock;
-	case_insensitive_map_t<unique_ptr<CatalogEntry>> entries;
-	bool is_loaded;
+	//! The entries are spread over several shards with their own lock, so that concurrent lookups of different
+	//! entries do not contend on a single lock
+	static constexpr const idx_t SHARD_COUNT = 16;
+	struct MySQLCatalogSetShard {
+		mutex lock;
+		//! Signalled when a lazy load of an entry of this shard has finished
+		std::condition_variable load_finished;
+		case_insensitive_map_t<unique_ptr<CatalogEntry>> entries;
+		//! Entries that have been looked up lazily but do not exist
+		case_insensitive_set_t missing_entries;
+		//! Entries that are being loaded lazily
+		case_insensitive_set_t loading_entries;
+		//! Entries that were invalidated after the set was loaded - they are reloaded one by one
+		case_insensitive_set_t invalidated_entries;
+	};
+
+	MySQLCatalogSetShard &GetShard(const string &name);
+	//! Loads all entries (once) - concurrent callers wait for the thread that runs the load
+	void EnsureLoaded(ClientContext &context);
+	optional_ptr<CatalogEntry> GetEntryLazy(ClientContext &context, const string &name);
+
+private:
+	MySQLCatalogSetShard shards[SHARD_COUNT];
+	//! Held while all entries are loaded or cleared
+	mutex load_lock;
+	atomic<bool> is_loaded;
 };
 
 class MySQLInSchemaSet : public MySQLCatalogSet {
@@ -9,18 +9,40 @@
 #pragma once
 
 #include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/common/optional_idx.hpp"
 
 namespace duckdb {
 class TableCatalogEntry;
 
+//! Modifies the rows produced by the child in batches, identified by their row id (i.e. their primary key) -
+//! instead of translating the entire plan into a single statement
+struct MySQLBatchedModification {
+	//! The primary key column that identifies the rows
+	string key_column;
+	//! The index of the row id in the chunks produced by the child
+	idx_t row_id_index = 0;
+	//! UPDATE only: the columns that are updated
+	vector<string> update_columns;
+	//! UPDATE only: the index of the new value of each updated column in the chunks, or invalid for DEFAULT
+	vector<optional_idx> update_value_indexes;
+	//! The maximum number of rows that are modified per statement
+	idx_t batch_size = 1000;
+	//! Whether or not every batch is committed separately (over its own connection)
+	bool commit_batches = false;
+};
+
 class MySQLExecuteQuery : public PhysicalOperator {
 public:
 	MySQLExecuteQuery(LogicalOperator &op, string op_name, TableCatalogEntry &table, string query);
+	MySQLExecuteQuery(LogicalOperator &op, string op_name, TableCatalogEntry &table,
+	                  unique_ptr<MySQLBatchedModification> batched);
 
 	//! The table to delete from
 	string op_name;
 	TableCatalogEntry &table;
 	string query;
+	//! If set, rows are modified in batches instead of running the query
+	unique_ptr<MySQLBatchedModification> batched;
 
 public:
 	// Source interface
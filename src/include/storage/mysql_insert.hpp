@@ -10,8 +10,10 @@
 
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/common/index_vector.hpp"
+#include "duckdb/parser/statement/insert_statement.hpp"
 
 namespace duckdb {
+class LogicalInsert;
 
 class MySQLInsert : public PhysicalOperator {
 public:
@@ -28,6 +30,20 @@ public:
 	unique_ptr<BoundCreateTableInfo> info;
 	//! column_index_map
 	physical_index_vector_t<idx_t> column_index_map;
+	//! Whether or not each thread inserts over its own connection
+	bool parallel = false;
+	//! Whether or not the threads insert into a staging table which is moved into the target table on finalize
+	bool use_staging_table = false;
+	//! What happens to rows that conflict with an existing row - THROW, NOTHING (INSERT IGNORE) or UPDATE
+	OnConflictAction on_conflict = OnConflictAction::THROW;
+	//! The assignments of the ON DUPLICATE KEY UPDATE clause (ON CONFLICT DO UPDATE only)
+	string update_assignments;
+
+public:
+	//! Enables parallel inserts if requested through the mysql_parallel_insert settings and allowed
+	void SetParallel(ClientContext &context, Catalog &catalog);
+	//! Translates the ON CONFLICT clause of the insert into INSERT IGNORE or ON DUPLICATE KEY UPDATE
+	void SetOnConflict(ClientContext &context, LogicalInsert &op);
 
 public:
 	// Source interface
@@ -40,7 +56,9 @@ public:
 public:
 	// Sink interface
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
 
@@ -49,7 +67,7 @@ public:
 	}
 
 	bool ParallelSink() const override {
-		return false;
+		return parallel;
 	}
 
 	string GetName() const override;
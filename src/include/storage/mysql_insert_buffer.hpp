@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/mysql_insert_buffer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "mysql_text_writer.hpp"
+
+namespace duckdb {
+class MySQLConnection;
+struct MySQLOperatorStats;
+
+//! How the values of a column are written into INSERT statements or LOAD DATA files
+enum class MySQLColumnFormat : uint8_t {
+	//! Formatted straight from the input vector by a formatter (integers, decimals, dates and timestamps)
+	FORMATTED,
+	//! Floating point values, written in DuckDB's (shortest round-trip) text representation
+	FLOAT,
+	DOUBLE,
+	//! Strings, written (escaped) straight from the input vector
+	VARCHAR,
+	//! Blobs, written as hex literals into INSERT statements or as their raw (escaped) bytes into LOAD DATA files
+	BLOB,
+	//! Any other type - the values are cast to VARCHAR first
+	CAST
+};
+
+struct MySQLColumnWriter;
+//! Formats the (non-NULL) value of the input vector at the given row into the buffer - returns the written length
+//! The buffer holds at least MySQLColumnWriter::MAX_FORMATTED_SIZE bytes
+typedef idx_t (*mysql_format_value_t)(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer);
+
+//! Writes the values of a column - chosen once per insert from the type of the column
+struct MySQLColumnWriter {
+	static constexpr const idx_t MAX_FORMATTED_SIZE = 64;
+
+	MySQLColumnFormat format = MySQLColumnFormat::CAST;
+	//! The formatter of FORMATTED columns
+	mysql_format_value_t format_value = nullptr;
+	//! Whether or not the values are quoted in INSERT statements
+	bool quote = true;
+	//! 10^scale of DECIMAL columns
+	uint64_t decimal_divisor = 1;
+	uint8_t decimal_scale = 0;
+
+	//! Returns the writers for columns of the given types - LOAD DATA files write booleans as 1 and 0
+	static vector<MySQLColumnWriter> GetWriters(const vector<LogicalType> &types, bool load_data);
+};
+
+struct MySQLInsertOptions {
+	//! The writers of the inserted columns
+	vector<MySQLColumnWriter> column_writers;
+	string base_insert_query;
+	//! Appended to every INSERT statement - the ON DUPLICATE KEY UPDATE clause of upserts
+	string insert_suffix;
+	//! The LOAD DATA query - if set data is inserted through LOAD DATA LOCAL INFILE instead of INSERT statements
+	string load_data_query;
+	//! The fixed batch size in bytes (if set through mysql_insert_batch_bytes), or 0 to size batches adaptively
+	idx_t batch_bytes = 0;
+	//! The largest batch that can be sent in a single INSERT statement - derived from @@max_allowed_packet
+	idx_t max_batch_bytes = 0;
+};
+
+//! Determines how many bytes of rows are batched together before they are sent to MySQL
+//! Unless a fixed size is configured batches grow while flushes are fast, and shrink when flushes become slow
+class MySQLInsertBatchSize {
+public:
+	static constexpr const idx_t MINIMUM_BATCH_SIZE = 8000;
+	static constexpr const idx_t INITIAL_BATCH_SIZE = 1024ULL * 1024ULL;
+	static constexpr const int64_t TARGET_FLUSH_MICROS = 100000;
+
+	MySQLInsertBatchSize(idx_t fixed_size, idx_t max_size)
+	    : adaptive(fixed_size == 0), max_size(MaxValue<idx_t>(max_size, MINIMUM_BATCH_SIZE)),
+	      size(adaptive ? MinValue<idx_t>(INITIAL_BATCH_SIZE, this->max_size) : fixed_size) {
+	}
+
+	idx_t Get() const {
+		return size;
+	}
+
+	//! Registers how long it took to flush a batch, and adjusts the batch size accordingly
+	void Update(int64_t elapsed_micros) {
+		if (!adaptive) {
+			return;
+		}
+		if (elapsed_micros < TARGET_FLUSH_MICROS / 2) {
+			size = MinValue<idx_t>(size * 2, max_size);
+		} else if (elapsed_micros > TARGET_FLUSH_MICROS * 2) {
+			size = MaxValue<idx_t>(size / 2, MINIMUM_BATCH_SIZE);
+		}
+	}
+
+private:
+	bool adaptive;
+	idx_t max_size;
+	idx_t size;
+};
+
+//! Formats rows into batches and flushes them to MySQL - either as INSERT statements or as LOAD DATA files
+//! This is used by INSERT / CREATE TABLE AS, and by COPY ... TO (FORMAT mysql)
+class MySQLInsertBuffer {
+public:
+	MySQLInsertBuffer(ClientContext &context, const MySQLInsertOptions &options, MySQLOperatorStats &stats);
+
+	void Append(ClientContext &context, MySQLConnection &con, DataChunk &chunk);
+	//! Sends any remaining buffered rows to MySQL
+	void Flush(MySQLConnection &con);
+
+private:
+	//! Casts the columns that are written as VARCHAR (MySQLColumnFormat::CAST) into varchar_chunk
+	void CastToVarchar(ClientContext &context, DataChunk &chunk);
+	Vector &GetInput(DataChunk &chunk, idx_t c) {
+		return column_writers[c].format == MySQLColumnFormat::CAST ? varchar_chunk.data[c] : chunk.data[c];
+	}
+	void FlushLoadData(MySQLConnection &con);
+	void FlushInsert(MySQLConnection &con);
+	void AppendLoadData(MySQLConnection &con, DataChunk &chunk);
+	void AppendInsert(MySQLConnection &con, DataChunk &chunk);
+
+private:
+	//! LOAD DATA is not bound by max_allowed_packet, so we can use larger batches
+	static constexpr const idx_t LOAD_DATA_FLUSH_SIZE = 16ULL * 1024ULL * 1024ULL;
+
+	//! The counters of the insert the buffer belongs to
+	MySQLOperatorStats &stats;
+	vector<MySQLColumnWriter> column_writers;
+	//! Whether any of the columns are cast to VARCHAR
+	bool has_cast_columns;
+	DataChunk varchar_chunk;
+	//! Holds the text of floating point values that do not fit in an inlined string - reset for every chunk
+	Vector string_heap;
+	//! The INSERT statement that is being built - the (reused) buffer starts with the base INSERT INTO ... VALUES
+	string insert_query;
+	idx_t base_insert_size;
+	string insert_suffix;
+	string load_data_query;
+	bool load_data;
+	MySQLInsertBatchSize batch_size;
+	idx_t load_data_flush_size;
+	//! The buffered rows that are sent to the server as the contents of the LOAD DATA file
+	MySQLTextWriter load_data_writer;
+};
+
+//! Returns the LOAD DATA LOCAL INFILE query that loads the (in-memory) rows into the given table
+//! If replace is set, rows that conflict with an existing row replace that row
+string GetLoadDataQuery(const string &table_name, const vector<string> &column_names, bool replace);
+
+} // namespace duckdb
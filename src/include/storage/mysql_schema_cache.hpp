@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/mysql_schema_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "storage/mysql_table_set.hpp"
+
+namespace duckdb {
+class MySQLCatalog;
+
+//! Persists the columns of the tables in a MySQL schema on disk, so that they can be reused by other processes
+//! The cache is keyed by the connection string and the schema, and validated against information_schema.tables
+class MySQLSchemaCache {
+public:
+	MySQLSchemaCache(ClientContext &context, MySQLCatalog &catalog, const string &schema_name);
+
+	//! Loads the columns from the cache - returns false if there is no valid cache for the schema
+	bool TryLoad(vector<MySQLColumnInfo> &columns);
+	//! Writes the columns of the schema to the cache
+	void Store(const vector<MySQLColumnInfo> &columns);
+
+private:
+	string GetFingerprint();
+
+private:
+	ClientContext &context;
+	MySQLCatalog &catalog;
+	string schema_name;
+	//! The path of the cache file - empty if the cache is disabled
+	string path;
+	//! The fingerprint of the schema, taken before loading the columns
+	string fingerprint;
+};
+
+} // namespace duckdb
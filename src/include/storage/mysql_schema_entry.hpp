@@ -40,6 +40,15 @@ public:
 	void DropEntry(ClientContext &context, DropInfo &info) override;
 	optional_ptr<CatalogEntry> GetEntry(CatalogTransaction transaction, CatalogType type, const string &name) override;
 
+	//! Loads the unique indexes of the tables of the schema - see MySQLTableSet::LoadUniqueIndexes
+	void LoadUniqueIndexes(ClientContext &context, MySQLTableEntry &table) {
+		tables.LoadUniqueIndexes(context, table);
+	}
+	//! Whether or not the tables of the schema have been loaded already
+	bool TablesAreLoaded() const {
+		return tables.IsLoaded();
+	}
+
 private:
 	void AlterTable(MySQLTransaction &transaction, RenameTableInfo &info);
 	void AlterTable(MySQLTransaction &transaction, RenameColumnInfo &info);
@@ -49,6 +58,8 @@ private:
 	void TryDropEntry(ClientContext &context, CatalogType catalog_type, const string &name);
 
 	MySQLCatalogSet &GetCatalogSet(CatalogType type);
+	//! Removes the cached entry of a table, so that it is reloaded from the server the next time it is used
+	void InvalidateTable(const string &table_name);
 
 private:
 	MySQLTableSet tables;
@@ -23,6 +23,10 @@ public:
 
 protected:
 	void LoadEntries(ClientContext &context) override;
+	optional_ptr<CatalogEntry> LoadEntry(ClientContext &context, const string &name) override;
+	bool SupportsLoadingEntries() const override {
+		return true;
+	}
 };
 
 } // namespace duckdb
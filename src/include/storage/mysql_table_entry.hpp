@@ -10,6 +10,9 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/table_storage_info.hpp"
 #include "mysql_utils.hpp"
 
 namespace duckdb {
@@ -30,6 +33,53 @@ struct MySQLTableInfo {
 	}
 
 	unique_ptr<CreateTableInfo> create_info;
+	//! The names of the primary key columns (if any)
+	vector<string> primary_key;
+};
+
+//! Statistics of a table, as estimated by MySQL
+struct MySQLTableStatistics {
+	//! The estimated number of rows in the table
+	idx_t cardinality = 0;
+	//! The estimated average size of a row in bytes
+	idx_t average_row_size = 0;
+	//! Whether or not the table is partitioned (see MySQLTableEntry::LoadPartitions)
+	bool partitioned = false;
+	//! The estimated number of distinct values per column - only known for indexed columns or columns with a histogram
+	case_insensitive_map_t<idx_t> distinct_counts;
+};
+
+//! How the rows of a partitioned table are distributed over its partitions
+enum class MySQLPartitionMethod : uint8_t {
+	//! RANGE or RANGE COLUMNS - every partition holds the values below its upper bound (and above the previous one)
+	RANGE,
+	//! LIST or LIST COLUMNS - every partition holds an explicit list of values
+	LIST,
+	//! HASH, KEY and their LINEAR variants - the partition of a row cannot be derived from a filter
+	HASH
+};
+
+//! A (top-level) partition of a partitioned table, as described by information_schema.partitions
+struct MySQLPartitionInfo {
+	string name;
+	//! The estimated number of rows in the partition (including all of its subpartitions)
+	idx_t estimated_rows = 0;
+	//! The bounds of RANGE partitions - the lower bound is inclusive, the upper bound exclusive. NULL if unbounded.
+	Value lower_bound;
+	Value upper_bound;
+	//! The (non-NULL) values of LIST partitions
+	vector<Value> values;
+	//! Whether or not rows where the partitioning column is NULL are stored in this partition
+	bool contains_null = false;
+};
+
+//! The partitions of a table - empty if the table is not partitioned
+struct MySQLTablePartitions {
+	MySQLPartitionMethod method = MySQLPartitionMethod::HASH;
+	//! The column the table is partitioned by - empty if the table is partitioned by an expression (or by several
+	//! columns), in which case partitions cannot be pruned
+	string column_name;
+	vector<MySQLPartitionInfo> partitions;
 };
 
 class MySQLTableEntry : public TableCatalogEntry {
@@ -46,6 +96,45 @@ public:
 
 	void BindUpdateConstraints(Binder &binder, LogicalGet &get, LogicalProjection &proj, LogicalUpdate &update,
 	                           ClientContext &context) override;
+
+	//! Returns the statistics of the table - these are fetched from MySQL once and cached with the entry
+	const MySQLTableStatistics &GetTableStatistics(ClientContext &context);
+	//! Returns the statistics of the table if they have been loaded already - without querying MySQL
+	optional_ptr<const MySQLTableStatistics> TryGetTableStatistics();
+	//! Returns the unique indexes (including the primary key) of the table - these are fetched from MySQL once (for
+	//! all loaded tables of the schema) and cached with the entry. Functional indexes are not included.
+	const vector<IndexInfo> &GetUniqueIndexes(ClientContext &context);
+	//! Sets the unique indexes from (index name, column name) pairs ordered by index and position in the index - the
+	//! column name is empty for expressions. Does nothing if the indexes have been set already.
+	void SetUniqueIndexes(const vector<pair<string, string>> &index_columns);
+	//! Returns whether or not the table is partitioned - from the statistics if they have been loaded, or else from a
+	//! lookup of the create options of the table (which is cached with the entry)
+	bool IsPartitioned(ClientContext &context);
+	//! Reads the partitions of the table from MySQL - these are not cached, as partitions can be added, reorganized or
+	//! dropped without any change to the columns of the table
+	unique_ptr<MySQLTablePartitions> LoadPartitions(ClientContext &context);
+	//! Estimates the number of rows matching a condition by asking MySQL's optimizer (through EXPLAIN). Estimates are
+	//! cached with the entry per condition. Returns false if MySQL did not provide an estimate.
+	bool GetFilteredCardinality(ClientContext &context, const string &condition, idx_t &result);
+	//! Returns the column that is read as the row id of the table - the primary key if it is a single integer column
+	//! that fits in a BIGINT. Returns an empty string if there is no such column, in which case the row id is NULL.
+	string GetRowIdColumn() const;
+
+public:
+	//! The names of the primary key columns (if any)
+	vector<string> primary_key;
+
+private:
+	//! The maximum number of cached estimates of conditions per table
+	static constexpr const idx_t MAX_FILTERED_CARDINALITIES = 256;
+
+	mutex statistics_lock;
+	unique_ptr<MySQLTableStatistics> statistics;
+	unique_ptr<vector<IndexInfo>> unique_indexes;
+	//! Whether or not the table is partitioned - if it has been looked up without loading the statistics
+	unique_ptr<bool> partitioned;
+	//! The estimated row counts of conditions - or INVALID_INDEX if MySQL did not provide an estimate
+	unordered_map<string, idx_t> filtered_cardinalities;
 };
 
 } // namespace duckdb
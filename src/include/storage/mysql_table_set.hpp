@@ -17,6 +17,15 @@ class MySQLConnection;
 class MySQLResult;
 class MySQLSchemaEntry;
 
+//! A column of a table, as described by information_schema.columns
+struct MySQLColumnInfo {
+	string table_name;
+	string column_name;
+	MySQLTypeData type_info;
+	bool is_nullable = true;
+	string column_key;
+};
+
 class MySQLTableSet : public MySQLInSchemaSet {
 public:
 	explicit MySQLTableSet(MySQLSchemaEntry &schema);
@@ -30,14 +39,30 @@ public:
 
 	void AlterTable(ClientContext &context, AlterTableInfo &info);
 
+	//! Loads the unique indexes of all loaded tables of the schema using a single query - or only those of the given
+	//! table if the tables of the schema are loaded lazily
+	void LoadUniqueIndexes(ClientContext &context, MySQLTableEntry &table);
+	//! Loads the columns of all tables in a set of schemas using a single query - grouped by schema name
+	static unordered_map<string, vector<MySQLColumnInfo>> LoadColumns(ClientContext &context, Catalog &catalog,
+	                                                                  const vector<string> &schema_names);
+
 protected:
 	void LoadEntries(ClientContext &context) override;
+	optional_ptr<CatalogEntry> LoadEntry(ClientContext &context, const string &table_name) override;
+	bool SupportsLazyLoading() const override {
+		return true;
+	}
 
 	void AlterTable(ClientContext &context, RenameTableInfo &info);
 	void AlterTable(ClientContext &context, RenameColumnInfo &info);
 	void AlterTable(ClientContext &context, AddColumnInfo &info);
 	void AlterTable(ClientContext &context, RemoveColumnInfo &info);
 
+	//! Loads the columns of all tables in the schema from information_schema.columns
+	vector<MySQLColumnInfo> LoadColumns(ClientContext &context);
+
+	static MySQLColumnInfo ReadColumn(MySQLResult &result, idx_t column_offset);
+	static void AddColumn(ClientContext &context, const MySQLColumnInfo &column_info, MySQLTableInfo &table_info);
 	static void AddColumn(ClientContext &context, MySQLResult &result, MySQLTableInfo &table_info,
 	                      idx_t column_offset = 0);
 };
@@ -10,11 +10,15 @@
 
 #include "duckdb/transaction/transaction.hpp"
 #include "mysql_connection.hpp"
+#include "mysql_connection_pool.hpp"
+#include "duckdb/common/optional_idx.hpp"
 
 namespace duckdb {
 class MySQLCatalog;
 class MySQLSchemaEntry;
 class MySQLTableEntry;
+class MySQLWatermarks;
+class MySQLReplicaRouter;
 
 enum class MySQLTransactionState { TRANSACTION_NOT_YET_STARTED, TRANSACTION_STARTED, TRANSACTION_FINISHED };
 
@@ -29,15 +33,64 @@ public:
 
 	MySQLConnection &GetConnection();
 	unique_ptr<MySQLResult> Query(const string &query);
+	//! Runs several queries in a single round trip - see MySQLConnection::QueryMultiple
+	vector<unique_ptr<MySQLResult>> QueryMultiple(const vector<string> &queries);
 	static MySQLTransaction &Get(ClientContext &context, Catalog &catalog);
+	//! The pool of the server the transaction reads from - a read replica for routed read-only transactions
+	MySQLConnectionPool &GetConnectionPool() {
+		return *connection_pool;
+	}
+	shared_ptr<MySQLConnectionPool> GetConnectionPoolPtr() {
+		return connection_pool;
+	}
 	AccessMode GetAccessMode() const {
 		return access_mode;
 	}
+	//! Whether or not work for the current statement can be done over a connection other than the transaction
+	//! connection - this is only safe if it cannot miss (or make) uncommitted changes, i.e. for read-only
+	//! databases or in auto-commit mode
+	static bool CanUseSeparateConnection(ClientContext &context, Catalog &catalog);
+	//! Drops the given (qualified) table after the transaction has been committed or rolled back
+	void DropTableOnCompletion(const string &table_name);
+	//! Opens "count" connections with read-only transactions that all share one consistent snapshot, by starting
+	//! them while commits are blocked. If this transaction has not started yet it shares the snapshot as well.
+	//! The connections have to be committed before they are returned to the pool.
+	vector<MySQLConnection> StartSnapshotConnections(ClientContext &context, idx_t count, const string &table_name);
+	//! Records the high watermark of a finished incremental scan once the transaction has been committed
+	void SetWatermarkOnCommit(const string &name, string watermark);
+	//! Invalidates the cached results and the cached copy of a table that the transaction has written to once the
+	//! transaction has been committed or rolled back - until then, other queries could still cache its previous rows
+	void InvalidateTableOnCompletion(const string &schema_name, const string &table_name);
+	//! Invalidates all cached results and cached tables once the transaction has been committed or rolled back
+	void InvalidateAllOnCompletion();
+
+private:
+	void StartTransaction(bool consistent_snapshot);
+	void DropPendingTables();
+	void InvalidatePendingTables();
 
 private:
+	MySQLCatalog &mysql_catalog;
+	shared_ptr<MySQLConnectionPool> connection_pool;
 	MySQLConnection connection;
 	MySQLTransactionState transaction_state;
+	//! Whether or not the connection can be returned to the pool, i.e. it is not in the middle of a transaction
+	bool connection_reusable = true;
 	AccessMode access_mode;
+	//! Tables that are dropped after the transaction finishes
+	vector<string> pending_drops;
+	//! The watermarks of the attached database, and the watermarks that are recorded there on commit
+	MySQLWatermarks &watermarks;
+	vector<pair<string, string>> pending_watermarks;
+	//! Incremental scans can finish on any thread
+	mutex watermark_lock;
+	//! The tables (schema and table name) the transaction has written to, which are invalidated when it finishes
+	vector<pair<string, string>> pending_invalidations;
+	bool pending_invalidate_all = false;
+	mutex invalidation_lock;
+	MySQLReplicaRouter &replica_router;
+	//! The replica the transaction was routed to - invalid if it runs on the primary
+	optional_idx replica_index;
 };
 
 } // namespace duckdb
@@ -0,0 +1,1044 @@
+#include "duckdb.hpp"
+
+#include "mysql_binlog.hpp"
+#include "mysql_escape.hpp"
+#include "mysql_scanner.hpp"
+#include "mysql_result.hpp"
+#include "storage/mysql_catalog.hpp"
+#include "storage/mysql_table_entry.hpp"
+#include "storage/mysql_transaction.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "utf8proc_wrapper.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// GTID Sets
+//===--------------------------------------------------------------------===//
+static bool IsHexDigit(char c) {
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+}
+
+static uint8_t HexDigitValue(char c) {
+	return c <= '9' ? uint8_t(c - '0') : uint8_t(c - 'a' + 10);
+}
+
+static string ParseUUID(const string &uuid_text, const string &gtid_text) {
+	auto uuid = StringUtil::Lower(uuid_text);
+	bool valid = uuid.size() == 36;
+	for (idx_t i = 0; valid && i < uuid.size(); i++) {
+		bool is_dash = i == 8 || i == 13 || i == 18 || i == 23;
+		valid = is_dash ? uuid[i] == '-' : IsHexDigit(uuid[i]);
+	}
+	if (!valid) {
+		throw InvalidInputException("Invalid GTID set \"%s\": \"%s\" is not a server uuid", gtid_text, uuid_text);
+	}
+	return uuid;
+}
+
+static int64_t ParseTransactionNumber(const string &number, const string &gtid_text) {
+	if (number.empty() || number.size() > 18) {
+		throw InvalidInputException("Invalid GTID set \"%s\": \"%s\" is not a transaction number", gtid_text, number);
+	}
+	int64_t result = 0;
+	for (auto c : number) {
+		if (c < '0' || c > '9') {
+			throw InvalidInputException("Invalid GTID set \"%s\": \"%s\" is not a transaction number", gtid_text,
+			                            number);
+		}
+		result = result * 10 + (c - '0');
+	}
+	return result;
+}
+
+MySQLGtidSet MySQLGtidSet::Parse(const string &text) {
+	MySQLGtidSet result;
+	// MySQL separates the entries of the server uuids with ",\n"
+	string gtid_text;
+	for (auto c : text) {
+		if (!StringUtil::CharacterIsSpace(c)) {
+			gtid_text += c;
+		}
+	}
+	if (gtid_text.empty()) {
+		return result;
+	}
+	for (auto &entry : StringUtil::Split(gtid_text, ',')) {
+		auto parts = StringUtil::Split(entry, ':');
+		if (parts.size() < 2) {
+			throw InvalidInputException("Invalid GTID set \"%s\": expected entries of the form uuid:1-5", text);
+		}
+		auto uuid = ParseUUID(parts[0], text);
+		for (idx_t i = 1; i < parts.size(); i++) {
+			auto bounds = StringUtil::Split(parts[i], '-');
+			if (bounds.empty() || bounds.size() > 2) {
+				throw InvalidInputException("Invalid GTID set \"%s\": \"%s\" is not an interval", text, parts[i]);
+			}
+			auto start = ParseTransactionNumber(bounds[0], text);
+			auto end = bounds.size() == 2 ? ParseTransactionNumber(bounds[1], text) : start;
+			if (start < 1 || end < start) {
+				throw InvalidInputException("Invalid GTID set \"%s\": \"%s\" is not an interval", text, parts[i]);
+			}
+			result.AddInterval(uuid, start, end);
+		}
+	}
+	return result;
+}
+
+void MySQLGtidSet::AddInterval(const string &uuid, int64_t start, int64_t end) {
+	auto &list = intervals[uuid];
+	list.emplace_back(start, end);
+	std::sort(list.begin(), list.end());
+	// merge overlapping and adjacent intervals
+	vector<pair<int64_t, int64_t>> merged;
+	for (auto &interval : list) {
+		if (!merged.empty() && interval.first <= merged.back().second + 1) {
+			merged.back().second = MaxValue(merged.back().second, interval.second);
+		} else {
+			merged.push_back(interval);
+		}
+	}
+	list = std::move(merged);
+}
+
+void MySQLGtidSet::Add(const string &uuid, int64_t gno) {
+	AddInterval(uuid, gno, gno);
+}
+
+static void WriteUInt64(string &result, uint64_t value) {
+	for (idx_t i = 0; i < sizeof(uint64_t); i++) {
+		result += char((value >> (8 * i)) & 0xFF);
+	}
+}
+
+string MySQLGtidSet::Encode() const {
+	string result;
+	WriteUInt64(result, intervals.size());
+	for (auto &entry : intervals) {
+		// the uuid is sent as its 16 bytes
+		string hex;
+		for (auto c : entry.first) {
+			if (c != '-') {
+				hex += c;
+			}
+		}
+		for (idx_t i = 0; i + 1 < hex.size(); i += 2) {
+			result += char((HexDigitValue(hex[i]) << 4) | HexDigitValue(hex[i + 1]));
+		}
+		WriteUInt64(result, entry.second.size());
+		for (auto &interval : entry.second) {
+			// the end of an encoded interval is exclusive
+			WriteUInt64(result, uint64_t(interval.first));
+			WriteUInt64(result, uint64_t(interval.second + 1));
+		}
+	}
+	return result;
+}
+
+string MySQLGtidSet::ToString() const {
+	string result;
+	for (auto &entry : intervals) {
+		if (!result.empty()) {
+			result += ",";
+		}
+		result += entry.first;
+		for (auto &interval : entry.second) {
+			result += ":" + to_string(interval.first);
+			if (interval.second != interval.first) {
+				result += "-" + to_string(interval.second);
+			}
+		}
+	}
+	return result;
+}
+
+string MySQLGtidSet::FormatUUID(const_data_ptr_t data) {
+	char hex[32];
+	MySQLEscape::WriteHex(data, 16, hex);
+	// server uuids are written in lower case (as in @@global.gtid_executed)
+	auto digits = StringUtil::Lower(string(hex, 32));
+	return digits.substr(0, 8) + "-" + digits.substr(8, 4) + "-" + digits.substr(12, 4) + "-" + digits.substr(16, 4) +
+	       "-" + digits.substr(20);
+}
+
+//===--------------------------------------------------------------------===//
+// Binlog Events
+//===--------------------------------------------------------------------===//
+//! The size of the (v4) header that precedes every binlog event
+static constexpr const idx_t BINLOG_EVENT_HEADER_SIZE = 19;
+//! Sent with COM_BINLOG_DUMP_GTID to stop at the end of the binlog instead of waiting for new events
+static constexpr const uint16_t BINLOG_DUMP_NON_BLOCK = 1;
+//! The columns describing the change that precede the columns of the table in the output
+static constexpr const idx_t BINLOG_METADATA_COLUMNS = 5;
+
+enum class MySQLBinlogEventType : uint8_t {
+	ROTATE = 4,
+	TABLE_MAP = 19,
+	WRITE_ROWS_V1 = 23,
+	UPDATE_ROWS_V1 = 24,
+	DELETE_ROWS_V1 = 25,
+	WRITE_ROWS = 30,
+	UPDATE_ROWS = 31,
+	DELETE_ROWS = 32,
+	GTID = 33,
+	PARTIAL_UPDATE_ROWS = 39
+};
+
+//! Reads the fields of a binlog event
+class MySQLBinlogBuffer {
+public:
+	MySQLBinlogBuffer(const_data_ptr_t data, idx_t size) : data(data), size(size) {
+	}
+
+	const_data_ptr_t Read(idx_t bytes) {
+		if (position + bytes > size) {
+			throw IOException("Malformed binlog event: read of %llu bytes at offset %llu exceeds event size %llu",
+			                  bytes, position, size);
+		}
+		auto result = data + position;
+		position += bytes;
+		return result;
+	}
+	void Skip(idx_t bytes) {
+		Read(bytes);
+	}
+	uint64_t ReadLE(idx_t bytes) {
+		auto ptr = Read(bytes);
+		uint64_t result = 0;
+		for (idx_t i = 0; i < bytes; i++) {
+			result |= uint64_t(ptr[i]) << (8 * i);
+		}
+		return result;
+	}
+	uint64_t ReadBE(idx_t bytes) {
+		auto ptr = Read(bytes);
+		uint64_t result = 0;
+		for (idx_t i = 0; i < bytes; i++) {
+			result = (result << 8) | ptr[i];
+		}
+		return result;
+	}
+	//! Reads a length-encoded integer
+	uint64_t ReadPacked() {
+		auto first = ReadLE(1);
+		switch (first) {
+		case 252:
+			return ReadLE(2);
+		case 253:
+			return ReadLE(3);
+		case 254:
+			return ReadLE(8);
+		default:
+			if (first > 252) {
+				throw IOException("Malformed binlog event: invalid length-encoded integer");
+			}
+			return first;
+		}
+	}
+	string ReadString(idx_t bytes) {
+		auto ptr = Read(bytes);
+		return string(const_char_ptr_cast(ptr), bytes);
+	}
+	idx_t Position() const {
+		return position;
+	}
+	idx_t Remaining() const {
+		return size - position;
+	}
+
+private:
+	const_data_ptr_t data;
+	idx_t size;
+	idx_t position = 0;
+};
+
+static bool IsBitSet(const_data_ptr_t bitmap, idx_t bit) {
+	return bitmap[bit / 8] & (1 << (bit % 8));
+}
+
+//! The column types of a table as described by a TABLE_MAP event
+struct MySQLBinlogTableMap {
+	vector<uint8_t> types;
+	//! The (at most two bytes of) metadata of every column, e.g. the maximum length or the precision and scale
+	vector<pair<uint8_t, uint8_t>> metadata;
+};
+
+struct MySQLBinlogColumn {
+	string name;
+	LogicalType type;
+	bool is_json = false;
+	//! The labels of ENUM and SET columns
+	vector<string> labels;
+};
+
+struct MySQLBinlogBindData : public TableFunctionData {
+	explicit MySQLBinlogBindData(Catalog &catalog) : catalog(catalog) {
+	}
+
+	Catalog &catalog;
+	string schema_name;
+	string table_name;
+	vector<MySQLBinlogColumn> columns;
+	//! The transactions that have already been read - only transactions that are not in this set are read
+	MySQLGtidSet from_gtid;
+	//! The name under which the GTID set of the read transactions is recorded
+	string watermark_name;
+	uint32_t server_id = 0;
+	//! Whether or not the binlog events of the server end with a CRC32 checksum
+	bool checksum = false;
+};
+
+struct MySQLBinlogGlobalState : public GlobalTableFunctionState {
+	~MySQLBinlogGlobalState() override {
+		if (binlog_open) {
+			mysql_binlog_close(connection.GetConn(), &rpl);
+		}
+	}
+
+	MySQLConnection connection;
+	MYSQL_RPL rpl;
+	bool binlog_open = false;
+	//! The encoded GTID set the binlog dump is started from - has to outlive the dump request
+	string encoded_gtid_set;
+	idx_t checksum_size = 0;
+	//! The transactions that have been read so far (including the transactions that were read before)
+	MySQLGtidSet gtid_set;
+	//! The transaction that records gtid_set as watermark once the end of the binlog is reached
+	optional_ptr<MySQLTransaction> transaction;
+	string watermark_name;
+	bool finished = false;
+
+	//! The position in the binlog
+	string binlog_file;
+	string gtid;
+	uint64_t position = 0;
+	timestamp_t timestamp;
+	//! The table maps of the scanned table by table id
+	unordered_map<uint64_t, MySQLBinlogTableMap> table_maps;
+
+	//! The rows event that is currently being read
+	MySQLBinlogEventType rows_event_type;
+	optional_ptr<MySQLBinlogTableMap> rows_table;
+	vector<data_t> rows_before_columns;
+	vector<data_t> rows_after_columns;
+	vector<data_t> rows_data;
+	idx_t rows_offset = 0;
+
+	bool HasPendingRows() const {
+		return rows_offset < rows_data.size();
+	}
+
+	void Finish() {
+		finished = true;
+		if (transaction) {
+			transaction->SetWatermarkOnCommit(watermark_name, gtid_set.ToString());
+			transaction = nullptr;
+		}
+	}
+};
+
+static void ReadTableMap(const MySQLBinlogBindData &bind_data, MySQLBinlogGlobalState &gstate,
+                         MySQLBinlogBuffer &event) {
+	auto table_id = event.ReadLE(6);
+	// flags
+	event.Skip(2);
+	auto schema_name = event.ReadString(event.ReadLE(1));
+	event.Skip(1);
+	auto table_name = event.ReadString(event.ReadLE(1));
+	event.Skip(1);
+	if (schema_name != bind_data.schema_name || table_name != bind_data.table_name) {
+		// the table id may have been re-used for another table
+		gstate.table_maps.erase(table_id);
+		return;
+	}
+	MySQLBinlogTableMap table_map;
+	auto column_count = event.ReadPacked();
+	auto types = event.Read(column_count);
+	table_map.types.assign(types, types + column_count);
+	auto metadata_size = event.ReadPacked();
+	MySQLBinlogBuffer metadata(event.Read(metadata_size), metadata_size);
+	for (auto type : table_map.types) {
+		pair<uint8_t, uint8_t> column_metadata(0, 0);
+		switch (type) {
+		case MYSQL_TYPE_FLOAT:
+		case MYSQL_TYPE_DOUBLE:
+		case MYSQL_TYPE_BLOB:
+		case MYSQL_TYPE_GEOMETRY:
+		case MYSQL_TYPE_JSON:
+		case MYSQL_TYPE_TIMESTAMP2:
+		case MYSQL_TYPE_DATETIME2:
+		case MYSQL_TYPE_TIME2:
+			column_metadata.first = uint8_t(metadata.ReadLE(1));
+			break;
+		case MYSQL_TYPE_VARCHAR:
+		case MYSQL_TYPE_VAR_STRING:
+		case MYSQL_TYPE_STRING:
+		case MYSQL_TYPE_ENUM:
+		case MYSQL_TYPE_SET:
+		case MYSQL_TYPE_BIT:
+		case MYSQL_TYPE_NEWDECIMAL:
+			column_metadata.first = uint8_t(metadata.ReadLE(1));
+			column_metadata.second = uint8_t(metadata.ReadLE(1));
+			break;
+		default:
+			break;
+		}
+		table_map.metadata.push_back(column_metadata);
+	}
+	gstate.table_maps[table_id] = std::move(table_map);
+}
+
+static void ReadRowsEvent(const MySQLBinlogBindData &bind_data, MySQLBinlogGlobalState &gstate,
+                          MySQLBinlogEventType type, MySQLBinlogBuffer &event) {
+	auto table_id = event.ReadLE(6);
+	// flags
+	event.Skip(2);
+	if (type == MySQLBinlogEventType::WRITE_ROWS || type == MySQLBinlogEventType::UPDATE_ROWS ||
+	    type == MySQLBinlogEventType::DELETE_ROWS) {
+		// v2 events have extra data - the length includes the two bytes of the length itself
+		auto extra_size = event.ReadLE(2);
+		if (extra_size < 2) {
+			throw IOException("Malformed binlog event: invalid extra data length %llu", extra_size);
+		}
+		event.Skip(extra_size - 2);
+	}
+	auto entry = gstate.table_maps.find(table_id);
+	if (entry == gstate.table_maps.end()) {
+		// the rows of another table
+		return;
+	}
+	auto column_count = event.ReadPacked();
+	if (column_count != bind_data.columns.size() || column_count != entry->second.types.size()) {
+		throw InvalidInputException("The binlog has rows with %llu columns for table \"%s\" which has %llu columns - "
+		                            "the table was altered after the change was made",
+		                            column_count, bind_data.table_name, bind_data.columns.size());
+	}
+	auto bitmap_size = (column_count + 7) / 8;
+	auto before_columns = event.Read(bitmap_size);
+	gstate.rows_before_columns.assign(before_columns, before_columns + bitmap_size);
+	if (type == MySQLBinlogEventType::UPDATE_ROWS || type == MySQLBinlogEventType::UPDATE_ROWS_V1) {
+		auto after_columns = event.Read(bitmap_size);
+		gstate.rows_after_columns.assign(after_columns, after_columns + bitmap_size);
+	} else {
+		gstate.rows_after_columns = gstate.rows_before_columns;
+	}
+	// the event is copied, as the rows might not all fit in the current chunk
+	auto rows_size = event.Remaining();
+	auto rows = event.Read(rows_size);
+	gstate.rows_data.assign(rows, rows + rows_size);
+	gstate.rows_offset = 0;
+	gstate.rows_event_type = type;
+	gstate.rows_table = &entry->second;
+}
+
+static void ReadBinlogEvent(const MySQLBinlogBindData &bind_data, MySQLBinlogGlobalState &gstate) {
+	auto &rpl = gstate.rpl;
+	auto conn = gstate.connection.GetConn();
+	if (mysql_binlog_fetch(conn, &rpl) != 0) {
+		throw IOException("Failed to read the binlog: %s", mysql_error(conn));
+	}
+	if (rpl.size == 0) {
+		// the end of the binlog has been reached
+		gstate.Finish();
+		return;
+	}
+	// mysql_binlog_fetch has already skipped the OK marker that precedes every event
+	if (rpl.size < BINLOG_EVENT_HEADER_SIZE + gstate.checksum_size) {
+		throw IOException("Malformed binlog event: event of %llu bytes is too small", idx_t(rpl.size));
+	}
+	MySQLBinlogBuffer header(rpl.buffer, BINLOG_EVENT_HEADER_SIZE);
+	auto timestamp = header.ReadLE(4);
+	auto type = MySQLBinlogEventType(header.ReadLE(1));
+	// server id and event size
+	header.Skip(8);
+	auto position = header.ReadLE(4);
+	MySQLBinlogBuffer event(rpl.buffer + BINLOG_EVENT_HEADER_SIZE,
+	                        rpl.size - BINLOG_EVENT_HEADER_SIZE - gstate.checksum_size);
+	switch (type) {
+	case MySQLBinlogEventType::ROTATE:
+		// the position in the new file
+		event.Skip(8);
+		gstate.binlog_file = event.ReadString(event.Remaining());
+		break;
+	case MySQLBinlogEventType::GTID: {
+		// flags
+		event.Skip(1);
+		auto uuid = MySQLGtidSet::FormatUUID(event.Read(16));
+		auto gno = int64_t(event.ReadLE(8));
+		gstate.gtid = uuid + ":" + to_string(gno);
+		gstate.gtid_set.Add(uuid, gno);
+		break;
+	}
+	case MySQLBinlogEventType::TABLE_MAP:
+		ReadTableMap(bind_data, gstate, event);
+		break;
+	case MySQLBinlogEventType::WRITE_ROWS_V1:
+	case MySQLBinlogEventType::UPDATE_ROWS_V1:
+	case MySQLBinlogEventType::DELETE_ROWS_V1:
+	case MySQLBinlogEventType::WRITE_ROWS:
+	case MySQLBinlogEventType::UPDATE_ROWS:
+	case MySQLBinlogEventType::DELETE_ROWS:
+		gstate.position = position;
+		gstate.timestamp = Timestamp::FromEpochSeconds(int64_t(timestamp));
+		ReadRowsEvent(bind_data, gstate, type, event);
+		break;
+	case MySQLBinlogEventType::PARTIAL_UPDATE_ROWS:
+		throw NotImplementedException("mysql_binlog_scan does not support partial JSON updates - SET GLOBAL "
+		                              "binlog_row_value_options='' on the server to log full rows");
+	default:
+		// other events (e.g. transaction boundaries and DDL) do not contain rows
+		break;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Row Decoding
+//===--------------------------------------------------------------------===//
+static string PadDigits(uint64_t value, idx_t digits) {
+	auto result = to_string(value);
+	if (result.size() < digits) {
+		result.insert(0, digits - result.size(), '0');
+	}
+	return result;
+}
+
+static Value DecodeBinlogInteger(MySQLBinlogBuffer &buffer, idx_t bytes, const LogicalType &type) {
+	auto value = buffer.ReadLE(bytes);
+	if (type.IsUnsigned()) {
+		return Value::UBIGINT(value);
+	}
+	auto bits = bytes * 8;
+	if (bits < 64 && (value >> (bits - 1)) & 1) {
+		// sign-extend negative values
+		value |= ~uint64_t(0) << bits;
+	}
+	return Value::BIGINT(int64_t(value));
+}
+
+static string DecodeBinlogDecimal(MySQLBinlogBuffer &buffer, uint8_t precision, uint8_t scale) {
+	// decimals are stored in groups of nine digits per four bytes - leftover digits use fewer bytes
+	static constexpr const idx_t DIGITS_PER_GROUP = 9;
+	static constexpr const idx_t DIGITS_TO_BYTES[] = {0, 1, 1, 2, 2, 3, 3, 4, 4, 4};
+	if (scale > precision) {
+		throw IOException("Malformed binlog event: invalid decimal precision %d and scale %d", precision, scale);
+	}
+	idx_t integral = precision - scale;
+	idx_t integral_groups = integral / DIGITS_PER_GROUP;
+	idx_t integral_digits = integral % DIGITS_PER_GROUP;
+	idx_t fractional_groups = scale / DIGITS_PER_GROUP;
+	idx_t fractional_digits = scale % DIGITS_PER_GROUP;
+	idx_t size = (integral_groups + fractional_groups) * 4 + DIGITS_TO_BYTES[integral_digits] +
+	             DIGITS_TO_BYTES[fractional_digits];
+	auto data = buffer.Read(size);
+	// the highest bit is set for positive numbers - negative numbers have all bits inverted
+	vector<data_t> bytes(data, data + size);
+	bool negative = size > 0 && (bytes[0] & 0x80) == 0;
+	if (size > 0) {
+		bytes[0] ^= 0x80;
+	}
+	if (negative) {
+		for (auto &byte : bytes) {
+			byte = ~byte;
+		}
+	}
+	MySQLBinlogBuffer digits(bytes.data(), size);
+	string result = negative ? "-" : "";
+	if (integral_digits > 0) {
+		result += PadDigits(digits.ReadBE(DIGITS_TO_BYTES[integral_digits]), integral_digits);
+	}
+	for (idx_t i = 0; i < integral_groups; i++) {
+		result += PadDigits(digits.ReadBE(4), DIGITS_PER_GROUP);
+	}
+	if (integral == 0) {
+		result += "0";
+	}
+	if (scale > 0) {
+		result += ".";
+		for (idx_t i = 0; i < fractional_groups; i++) {
+			result += PadDigits(digits.ReadBE(4), DIGITS_PER_GROUP);
+		}
+		if (fractional_digits > 0) {
+			result += PadDigits(digits.ReadBE(DIGITS_TO_BYTES[fractional_digits]), fractional_digits);
+		}
+	}
+	return result;
+}
+
+//! Reads the fractional seconds of a DATETIME2 or TIMESTAMP2 value as microseconds
+static int64_t DecodeBinlogFraction(MySQLBinlogBuffer &buffer, uint8_t precision) {
+	switch ((precision + 1) / 2) {
+	case 0:
+		return 0;
+	case 1:
+		return int64_t(buffer.ReadBE(1)) * 10000;
+	case 2:
+		return int64_t(buffer.ReadBE(2)) * 100;
+	case 3:
+		return int64_t(buffer.ReadBE(3));
+	default:
+		throw IOException("Malformed binlog event: invalid fractional seconds precision %d", precision);
+	}
+}
+
+static Value DecodeBinlogDatetime(MySQLBinlogBuffer &buffer, uint8_t precision) {
+	auto packed = int64_t(buffer.ReadBE(5)) - 0x8000000000LL;
+	auto micros = DecodeBinlogFraction(buffer, precision);
+	auto date_part = packed >> 17;
+	auto time_part = packed % (1 << 17);
+	auto year_month = date_part >> 5;
+	auto year = int32_t(year_month / 13);
+	auto month = int32_t(year_month % 13);
+	auto day = int32_t(date_part % (1 << 5));
+	if (packed < 0 || !Date::IsValid(year, month, day)) {
+		// MySQL allows "zero" dates (e.g. 0000-00-00) which we cannot represent
+		return Value(LogicalType::TIMESTAMP);
+	}
+	auto time = Time::FromTime(int32_t(time_part >> 12), int32_t((time_part >> 6) % (1 << 6)),
+	                           int32_t(time_part % (1 << 6)), int32_t(micros));
+	return Value::TIMESTAMP(Timestamp::FromDatetime(Date::FromDate(year, month, day), time));
+}
+
+static Value DecodeBinlogTime(MySQLBinlogBuffer &buffer, uint8_t precision) {
+	// times are stored as the integer part followed by the fraction - following my_time_packed_from_binary
+	auto integer_part = int64_t(buffer.ReadBE(3)) - 0x800000LL;
+	int64_t fraction = 0;
+	switch ((precision + 1) / 2) {
+	case 0:
+		break;
+	case 1:
+		fraction = int64_t(buffer.ReadBE(1));
+		if (integer_part < 0 && fraction) {
+			integer_part++;
+			fraction -= 0x100;
+		}
+		fraction *= 10000;
+		break;
+	case 2:
+		fraction = int64_t(buffer.ReadBE(2));
+		if (integer_part < 0 && fraction) {
+			integer_part++;
+			fraction -= 0x10000;
+		}
+		fraction *= 100;
+		break;
+	case 3:
+		fraction = int64_t(buffer.ReadBE(3));
+		break;
+	default:
+		throw IOException("Malformed binlog event: invalid fractional seconds precision %d", precision);
+	}
+	auto packed = integer_part * (1 << 24) + fraction;
+	bool negative = packed < 0;
+	if (negative) {
+		packed = -packed;
+	}
+	auto hms = packed >> 24;
+	auto micros = uint64_t(packed % (1 << 24));
+	// format the time as MySQL does - as the hours of a TIME can exceed 24
+	string result = negative ? "-" : "";
+	result += PadDigits(uint64_t((hms >> 12) % (1 << 10)), 2) + ":" + PadDigits(uint64_t((hms >> 6) % (1 << 6)), 2) +
+	          ":" + PadDigits(uint64_t(hms % (1 << 6)), 2);
+	if (precision > 0 && precision <= 6) {
+		static constexpr const uint64_t POWERS_OF_TEN[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+		result += "." + PadDigits(micros / POWERS_OF_TEN[6 - precision], precision);
+	}
+	return Value(result);
+}
+
+static Value DecodeBinlogString(const_data_ptr_t data, idx_t length, const LogicalType &type) {
+	if (type.id() == LogicalTypeId::BLOB) {
+		return Value::BLOB(data, length);
+	}
+	auto str = const_char_ptr_cast(data);
+	if (Utf8Proc::Analyze(str, length) == UnicodeType::INVALID) {
+		return Value(type);
+	}
+	return Value(string(str, length));
+}
+
+static Value DecodeBinlogEnum(MySQLBinlogBuffer &buffer, idx_t size, const MySQLBinlogColumn &column) {
+	auto index = buffer.ReadLE(size);
+	if (index == 0 || index > column.labels.size()) {
+		// invalid values are stored as the empty string
+		return Value("");
+	}
+	return Value(column.labels[index - 1]);
+}
+
+static Value DecodeBinlogSet(MySQLBinlogBuffer &buffer, idx_t size, const MySQLBinlogColumn &column) {
+	auto members = buffer.ReadLE(size);
+	string result;
+	for (idx_t i = 0; i < column.labels.size() && i < 64; i++) {
+		if (!(members & (uint64_t(1) << i))) {
+			continue;
+		}
+		if (!result.empty()) {
+			result += ",";
+		}
+		result += column.labels[i];
+	}
+	return Value(result);
+}
+
+static Value DecodeBinlogValue(MySQLBinlogBuffer &buffer, uint8_t type, const pair<uint8_t, uint8_t> &metadata,
+                               const MySQLBinlogColumn &column) {
+	switch (type) {
+	case MYSQL_TYPE_TINY:
+		return DecodeBinlogInteger(buffer, 1, column.type);
+	case MYSQL_TYPE_SHORT:
+		return DecodeBinlogInteger(buffer, 2, column.type);
+	case MYSQL_TYPE_INT24:
+		return DecodeBinlogInteger(buffer, 3, column.type);
+	case MYSQL_TYPE_LONG:
+		return DecodeBinlogInteger(buffer, 4, column.type);
+	case MYSQL_TYPE_LONGLONG:
+		return DecodeBinlogInteger(buffer, 8, column.type);
+	case MYSQL_TYPE_YEAR: {
+		auto year = buffer.ReadLE(1);
+		return Value::INTEGER(year == 0 ? 0 : int32_t(1900 + year));
+	}
+	case MYSQL_TYPE_FLOAT:
+		return Value::FLOAT(Load<float>(buffer.Read(sizeof(float))));
+	case MYSQL_TYPE_DOUBLE:
+		return Value::DOUBLE(Load<double>(buffer.Read(sizeof(double))));
+	case MYSQL_TYPE_NEWDECIMAL:
+		return Value(DecodeBinlogDecimal(buffer, metadata.first, metadata.second));
+	case MYSQL_TYPE_DATE: {
+		auto date = buffer.ReadLE(3);
+		auto year = int32_t(date >> 9);
+		auto month = int32_t((date >> 5) % (1 << 4));
+		auto day = int32_t(date % (1 << 5));
+		if (!Date::IsValid(year, month, day)) {
+			return Value(LogicalType::DATE);
+		}
+		return Value::DATE(Date::FromDate(year, month, day));
+	}
+	case MYSQL_TYPE_DATETIME2:
+		return DecodeBinlogDatetime(buffer, metadata.first);
+	case MYSQL_TYPE_TIMESTAMP2: {
+		// timestamps are stored in UTC
+		auto seconds = int64_t(buffer.ReadBE(4));
+		auto micros = DecodeBinlogFraction(buffer, metadata.first);
+		if (seconds == 0 && micros == 0) {
+			// the "zero" timestamp
+			return Value(LogicalType::TIMESTAMP);
+		}
+		return Value::TIMESTAMP(Timestamp::FromEpochMicroSeconds(seconds * Interval::MICROS_PER_SEC + micros));
+	}
+	case MYSQL_TYPE_TIME2:
+		return DecodeBinlogTime(buffer, metadata.first);
+	case MYSQL_TYPE_VARCHAR:
+	case MYSQL_TYPE_VAR_STRING: {
+		auto max_length = idx_t(metadata.first) | (idx_t(metadata.second) << 8);
+		auto length = buffer.ReadLE(max_length > 255 ? 2 : 1);
+		return DecodeBinlogString(buffer.Read(length), length, column.type);
+	}
+	case MYSQL_TYPE_STRING: {
+		// the first byte of the metadata is the real type - the maximum length is spread over both bytes
+		auto real_type = metadata.first;
+		if (real_type == MYSQL_TYPE_ENUM) {
+			return DecodeBinlogEnum(buffer, metadata.second, column);
+		}
+		if (real_type == MYSQL_TYPE_SET) {
+			return DecodeBinlogSet(buffer, metadata.second, column);
+		}
+		auto max_length = (((idx_t(metadata.first) << 4) & 0x300) ^ 0x300) + metadata.second;
+		auto length = buffer.ReadLE(max_length > 255 ? 2 : 1);
+		return DecodeBinlogString(buffer.Read(length), length, column.type);
+	}
+	case MYSQL_TYPE_ENUM:
+		return DecodeBinlogEnum(buffer, metadata.second, column);
+	case MYSQL_TYPE_SET:
+		return DecodeBinlogSet(buffer, metadata.second, column);
+	case MYSQL_TYPE_BIT: {
+		auto bits = idx_t(metadata.second) * 8 + metadata.first;
+		auto length = (bits + 7) / 8;
+		auto data = buffer.Read(length);
+		if (column.type.id() == LogicalTypeId::BOOLEAN) {
+			bool is_set = false;
+			for (idx_t i = 0; i < length; i++) {
+				is_set = is_set || data[i] != 0;
+			}
+			return Value::BOOLEAN(is_set);
+		}
+		return Value::BLOB(data, length);
+	}
+	case MYSQL_TYPE_BLOB:
+	case MYSQL_TYPE_GEOMETRY: {
+		// the metadata is the number of bytes of the length
+		auto length = buffer.ReadLE(metadata.first);
+		return DecodeBinlogString(buffer.Read(length), length, column.type);
+	}
+	default:
+		throw NotImplementedException("mysql_binlog_scan does not support column \"%s\" with binlog type %d",
+		                              column.name, type);
+	}
+}
+
+//! Decodes a row image - columns that are not part of the image (see binlog_row_image) are NULL
+static void DecodeBinlogRow(const MySQLBinlogBindData &bind_data, MySQLBinlogBuffer &buffer,
+                            const MySQLBinlogTableMap &table_map, const vector<data_t> &image_columns,
+                            DataChunk &output, idx_t row) {
+	idx_t image_column_count = 0;
+	for (idx_t c = 0; c < bind_data.columns.size(); c++) {
+		if (IsBitSet(image_columns.data(), c)) {
+			image_column_count++;
+		}
+	}
+	// the NULL bitmap only has bits for the columns that are part of the image
+	auto null_bitmap = buffer.Read((image_column_count + 7) / 8);
+	idx_t image_column_idx = 0;
+	for (idx_t c = 0; c < bind_data.columns.size(); c++) {
+		auto &column = bind_data.columns[c];
+		auto output_idx = BINLOG_METADATA_COLUMNS + c;
+		if (!IsBitSet(image_columns.data(), c) || IsBitSet(null_bitmap, image_column_idx++)) {
+			output.SetValue(output_idx, row, Value(column.type));
+			continue;
+		}
+		auto value = DecodeBinlogValue(buffer, table_map.types[c], table_map.metadata[c], column);
+		Value result;
+		if (value.IsNull() || !value.DefaultTryCastAs(column.type, result, nullptr)) {
+			result = Value(column.type);
+		}
+		output.SetValue(output_idx, row, result);
+	}
+}
+
+static void WriteChangeColumns(MySQLBinlogGlobalState &gstate, const string &op, DataChunk &output, idx_t row) {
+	output.SetValue(0, row, Value(op));
+	output.SetValue(1, row, gstate.gtid.empty() ? Value(LogicalType::VARCHAR) : Value(gstate.gtid));
+	output.SetValue(2, row, Value(gstate.binlog_file));
+	output.SetValue(3, row, Value::UBIGINT(gstate.position));
+	output.SetValue(4, row, Value::TIMESTAMPTZ(timestamp_tz_t(gstate.timestamp)));
+}
+
+//! Decodes the next row of the current rows event - returns the number of output rows (two for updates)
+static idx_t ReadBinlogRow(const MySQLBinlogBindData &bind_data, MySQLBinlogGlobalState &gstate, DataChunk &output,
+                           idx_t row) {
+	MySQLBinlogBuffer buffer(gstate.rows_data.data() + gstate.rows_offset,
+	                         gstate.rows_data.size() - gstate.rows_offset);
+	auto &table_map = *gstate.rows_table;
+	idx_t row_count;
+	switch (gstate.rows_event_type) {
+	case MySQLBinlogEventType::WRITE_ROWS_V1:
+	case MySQLBinlogEventType::WRITE_ROWS:
+		WriteChangeColumns(gstate, "insert", output, row);
+		DecodeBinlogRow(bind_data, buffer, table_map, gstate.rows_before_columns, output, row);
+		row_count = 1;
+		break;
+	case MySQLBinlogEventType::DELETE_ROWS_V1:
+	case MySQLBinlogEventType::DELETE_ROWS:
+		WriteChangeColumns(gstate, "delete", output, row);
+		DecodeBinlogRow(bind_data, buffer, table_map, gstate.rows_before_columns, output, row);
+		row_count = 1;
+		break;
+	default:
+		// updates have the row before the update followed by the row after the update
+		WriteChangeColumns(gstate, "update_before", output, row);
+		DecodeBinlogRow(bind_data, buffer, table_map, gstate.rows_before_columns, output, row);
+		WriteChangeColumns(gstate, "update_after", output, row + 1);
+		DecodeBinlogRow(bind_data, buffer, table_map, gstate.rows_after_columns, output, row + 1);
+		row_count = 2;
+		break;
+	}
+	gstate.rows_offset += buffer.Position();
+	return row_count;
+}
+
+//===--------------------------------------------------------------------===//
+// mysql_binlog_scan
+//===--------------------------------------------------------------------===//
+//! Parses the labels of an ENUM or SET column from its column type, e.g. enum('a','b')
+static vector<string> ParseTypeLabels(const string &column_type) {
+	vector<string> labels;
+	auto start = column_type.find('(');
+	if (start == string::npos) {
+		return labels;
+	}
+	for (idx_t i = start + 1; i < column_type.size(); i++) {
+		if (column_type[i] != '\'') {
+			continue;
+		}
+		string label;
+		for (i++; i < column_type.size(); i++) {
+			if (column_type[i] == '\'') {
+				if (i + 1 < column_type.size() && column_type[i + 1] == '\'') {
+					// escaped quote
+					label += '\'';
+					i++;
+					continue;
+				}
+				break;
+			}
+			label += column_type[i];
+		}
+		labels.push_back(std::move(label));
+	}
+	return labels;
+}
+
+static unique_ptr<FunctionData> MySQLBinlogScanBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	for (auto &input_value : input.inputs) {
+		if (input_value.IsNull()) {
+			throw BinderException("Parameters to mysql_binlog_scan cannot be NULL");
+		}
+	}
+	auto db_name = input.inputs[0].GetValue<string>();
+	auto db = DatabaseManager::Get(context).GetDatabase(context, db_name);
+	if (!db) {
+		throw BinderException("Failed to find attached database \"%s\" referenced in mysql_binlog_scan", db_name);
+	}
+	auto &catalog = db->GetCatalog();
+	if (catalog.GetCatalogType() != "mysql") {
+		throw BinderException("Attached database \"%s\" does not refer to a MySQL database", db_name);
+	}
+	auto &table = catalog
+	                  .GetEntry<TableCatalogEntry>(context, input.inputs[1].GetValue<string>(),
+	                                               input.inputs[2].GetValue<string>())
+	                  .Cast<MySQLTableEntry>();
+
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto settings = transaction.Query(
+	    "SELECT @@global.log_bin, @@global.gtid_mode, @@global.binlog_format, @@global.binlog_checksum");
+	if (!settings->Next()) {
+		throw IOException("Failed to read the binlog settings of the server");
+	}
+	if (settings->GetString(0) != "1") {
+		throw BinderException("mysql_binlog_scan requires the binary log to be enabled on the server (log_bin)");
+	}
+	if (!StringUtil::CIEquals(settings->GetString(1), "ON")) {
+		throw BinderException("mysql_binlog_scan requires gtid_mode=ON on the server, but gtid_mode is %s",
+		                      settings->GetString(1));
+	}
+	if (!StringUtil::CIEquals(settings->GetString(2), "ROW")) {
+		throw BinderException("mysql_binlog_scan requires binlog_format=ROW on the server, but binlog_format is %s",
+		                      settings->GetString(2));
+	}
+
+	auto result = make_uniq<MySQLBinlogBindData>(catalog);
+	result->schema_name = table.schema.name;
+	result->table_name = table.name;
+	result->checksum = StringUtil::CIEquals(settings->GetString(3), "CRC32");
+	for (auto &col : table.GetColumns().Logical()) {
+		MySQLBinlogColumn column;
+		column.name = col.GetName();
+		column.type = col.GetType();
+		result->columns.push_back(std::move(column));
+	}
+	// ENUM and SET values are logged as numbers - fetch the labels to translate them
+	auto column_types = transaction.Query(
+	    "SELECT column_name, data_type, column_type FROM information_schema.columns WHERE table_schema = " +
+	    MySQLUtils::WriteLiteral(table.schema.name) + " AND table_name = " + MySQLUtils::WriteLiteral(table.name));
+	while (column_types->Next()) {
+		auto column_name = column_types->GetString(0);
+		auto data_type = StringUtil::Lower(column_types->GetString(1));
+		for (auto &column : result->columns) {
+			if (!StringUtil::CIEquals(column.name, column_name)) {
+				continue;
+			}
+			if (data_type == "json") {
+				throw BinderException("Column \"%s\" of table \"%s\" is a JSON column - JSON columns are not "
+				                      "supported by mysql_binlog_scan",
+				                      column.name, table.name);
+			}
+			if (data_type == "enum" || data_type == "set") {
+				column.labels = ParseTypeLabels(column_types->GetString(2));
+			}
+		}
+	}
+
+	result->watermark_name = "binlog:" + table.schema.name + "." + table.name;
+	bool has_from_gtid = false;
+	string from_gtid;
+	for (auto &entry : input.named_parameters) {
+		if (entry.first == "from_gtid") {
+			has_from_gtid = true;
+			if (!entry.second.IsNull()) {
+				from_gtid = StringValue::Get(entry.second);
+			}
+		} else if (entry.first == "name") {
+			result->watermark_name = StringValue::Get(entry.second);
+		} else if (entry.first == "server_id") {
+			result->server_id = UIntegerValue::Get(entry.second);
+		}
+	}
+	if (!has_from_gtid) {
+		// continue after the transactions read by the previous scan with the same name
+		catalog.Cast<MySQLCatalog>().GetWatermarks().TryGet(result->watermark_name, from_gtid);
+	}
+	result->from_gtid = MySQLGtidSet::Parse(from_gtid);
+
+	names = {"_op", "_gtid", "_binlog_file", "_binlog_position", "_timestamp"};
+	return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::UBIGINT,
+	                LogicalType::TIMESTAMP_TZ};
+	for (auto &column : result->columns) {
+		names.push_back(column.name);
+		return_types.push_back(column.type);
+	}
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> MySQLBinlogScanInitGlobalState(ClientContext &context,
+                                                                           TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<MySQLBinlogBindData>();
+	auto &mysql_catalog = bind_data.catalog.Cast<MySQLCatalog>();
+	auto result = make_uniq<MySQLBinlogGlobalState>();
+	result->gtid_set = bind_data.from_gtid;
+	result->watermark_name = bind_data.watermark_name;
+	result->transaction = &MySQLTransaction::Get(context, bind_data.catalog);
+	result->checksum_size = bind_data.checksum ? sizeof(uint32_t) : 0;
+
+	// the binlog is read over a dedicated connection - a connection cannot run queries after a binlog dump
+	result->connection = MySQLConnection::Open(mysql_catalog.GetConnectionPool().GetConnectionString());
+	// the server only sends events with checksums to clients that announce they can handle them
+	result->connection.Execute("SET @master_binlog_checksum = @@global.binlog_checksum, @source_binlog_checksum = "
+	                           "@@global.binlog_checksum");
+
+	result->encoded_gtid_set = result->gtid_set.Encode();
+	auto &rpl = result->rpl;
+	memset(&rpl, 0, sizeof(MYSQL_RPL));
+	rpl.start_position = 4;
+	rpl.server_id = bind_data.server_id;
+	rpl.flags = MYSQL_RPL_GTID | BINLOG_DUMP_NON_BLOCK;
+	rpl.gtid_set_encoded_size = result->encoded_gtid_set.size();
+	rpl.gtid_set_arg = (void *)result->encoded_gtid_set.data();
+	auto conn = result->connection.GetConn();
+	if (mysql_binlog_open(conn, &rpl) != 0) {
+		throw IOException("Failed to start reading the binlog: %s", mysql_error(conn));
+	}
+	result->binlog_open = true;
+	return std::move(result);
+}
+
+static void MySQLBinlogScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+	auto &bind_data = data.bind_data->Cast<MySQLBinlogBindData>();
+	auto &gstate = data.global_state->Cast<MySQLBinlogGlobalState>();
+	idx_t count = 0;
+	// leave room for both rows of an update
+	while (count + 2 <= STANDARD_VECTOR_SIZE) {
+		if (gstate.HasPendingRows()) {
+			count += ReadBinlogRow(bind_data, gstate, output, count);
+			continue;
+		}
+		if (gstate.finished) {
+			break;
+		}
+		ReadBinlogEvent(bind_data, gstate);
+	}
+	output.SetCardinality(count);
+}
+
+MySQLBinlogScanFunction::MySQLBinlogScanFunction()
+    : TableFunction("mysql_binlog_scan", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
+                    MySQLBinlogScan, MySQLBinlogScanBind, MySQLBinlogScanInitGlobalState) {
+	named_parameters["from_gtid"] = LogicalType::VARCHAR;
+	named_parameters["name"] = LogicalType::VARCHAR;
+	named_parameters["server_id"] = LogicalType::UINTEGER;
+}
+
+} // namespace duckdb
@@ -0,0 +1,891 @@
+#include "duckdb.hpp"
+
+#include "mysql_cached_tables.hpp"
+#include "mysql_result_cache.hpp"
+#include "mysql_scanner.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+#include "storage/mysql_catalog.hpp"
+#include "storage/mysql_table_entry.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Cached Rows
+//===--------------------------------------------------------------------===//
+MySQLCachedTableData::MySQLCachedTableData(vector<string> names_p, vector<LogicalType> types_p)
+    : names(std::move(names_p)), types(std::move(types_p)) {
+}
+
+template <class T>
+static void UpdateNumericStatistics(BaseStatistics &stats, UnifiedVectorFormat &format, idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(format);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = format.sel->get_index(i);
+		if (!format.validity.RowIsValid(idx)) {
+			stats.SetHasNull();
+			continue;
+		}
+		stats.SetHasNoNull();
+		NumericStats::Update<T>(stats, data[idx]);
+	}
+}
+
+static void UpdateStringStatistics(BaseStatistics &stats, UnifiedVectorFormat &format, idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<string_t>(format);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = format.sel->get_index(i);
+		if (!format.validity.RowIsValid(idx)) {
+			stats.SetHasNull();
+			continue;
+		}
+		stats.SetHasNoNull();
+		StringStats::Update(stats, data[idx]);
+	}
+}
+
+static bool HasStatistics(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return BaseStatistics::GetStatsType(type) == StatisticsType::NUMERIC_STATS;
+	case PhysicalType::VARCHAR:
+		return BaseStatistics::GetStatsType(type) == StatisticsType::STRING_STATS;
+	default:
+		return false;
+	}
+}
+
+//! Updates the statistics of a column of a row group with the values of a vector
+static void UpdateStatistics(BaseStatistics &stats, const LogicalType &type, Vector &vector, idx_t count) {
+	if (!HasStatistics(type)) {
+		// the statistics are unknown - row groups are never skipped by filters on this column
+		return;
+	}
+	UnifiedVectorFormat format;
+	vector.ToUnifiedFormat(count, format);
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+		UpdateNumericStatistics<bool>(stats, format, count);
+		break;
+	case PhysicalType::INT8:
+		UpdateNumericStatistics<int8_t>(stats, format, count);
+		break;
+	case PhysicalType::INT16:
+		UpdateNumericStatistics<int16_t>(stats, format, count);
+		break;
+	case PhysicalType::INT32:
+		UpdateNumericStatistics<int32_t>(stats, format, count);
+		break;
+	case PhysicalType::INT64:
+		UpdateNumericStatistics<int64_t>(stats, format, count);
+		break;
+	case PhysicalType::INT128:
+		UpdateNumericStatistics<hugeint_t>(stats, format, count);
+		break;
+	case PhysicalType::UINT8:
+		UpdateNumericStatistics<uint8_t>(stats, format, count);
+		break;
+	case PhysicalType::UINT16:
+		UpdateNumericStatistics<uint16_t>(stats, format, count);
+		break;
+	case PhysicalType::UINT32:
+		UpdateNumericStatistics<uint32_t>(stats, format, count);
+		break;
+	case PhysicalType::UINT64:
+		UpdateNumericStatistics<uint64_t>(stats, format, count);
+		break;
+	case PhysicalType::FLOAT:
+		UpdateNumericStatistics<float>(stats, format, count);
+		break;
+	case PhysicalType::DOUBLE:
+		UpdateNumericStatistics<double>(stats, format, count);
+		break;
+	case PhysicalType::VARCHAR:
+		UpdateStringStatistics(stats, format, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for statistics of cached MySQL table");
+	}
+}
+
+void MySQLCachedTableData::Append(DataChunk &chunk) {
+	if (chunk.size() == 0) {
+		return;
+	}
+	// chunks are not split across row groups - row groups can exceed ROW_GROUP_SIZE by less than a chunk
+	if (row_groups.empty() || row_groups.back().rows->Count() >= ROW_GROUP_SIZE) {
+		MySQLCachedRowGroup row_group;
+		row_group.rows = make_uniq<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+		for (auto &type : types) {
+			row_group.statistics.push_back(HasStatistics(type) ? BaseStatistics::CreateEmpty(type)
+			                                                   : BaseStatistics::CreateUnknown(type));
+		}
+		row_groups.push_back(std::move(row_group));
+	}
+	auto &row_group = row_groups.back();
+	for (idx_t c = 0; c < types.size(); c++) {
+		UpdateStatistics(row_group.statistics[c], types[c], chunk.data[c], chunk.size());
+	}
+	row_group.rows->Append(chunk);
+	count += chunk.size();
+}
+
+Value MySQLCachedTableData::GetMaximum(idx_t column_index) const {
+	auto &type = types[column_index];
+	Value result(type);
+	if (BaseStatistics::GetStatsType(type) != StatisticsType::NUMERIC_STATS) {
+		return result;
+	}
+	for (auto &row_group : row_groups) {
+		auto &stats = row_group.statistics[column_index];
+		if (!NumericStats::HasMax(stats)) {
+			continue;
+		}
+		auto max = NumericStats::Max(stats);
+		if (result.IsNull() || max > result) {
+			result = std::move(max);
+		}
+	}
+	return result;
+}
+
+idx_t MySQLCachedTableData::GetColumnIndex(const string &name) const {
+	for (idx_t c = 0; c < names.size(); c++) {
+		if (StringUtil::CIEquals(names[c], name)) {
+			return c;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+//===--------------------------------------------------------------------===//
+// Cached Table
+//===--------------------------------------------------------------------===//
+MySQLCachedTable::MySQLCachedTable(string schema_name_p, string table_name_p, idx_t refresh_seconds,
+                                   string watermark_column_p, vector<string> primary_key_p)
+    : schema_name(std::move(schema_name_p)), table_name(std::move(table_name_p)), refresh_seconds(refresh_seconds),
+      watermark_column(std::move(watermark_column_p)), primary_key(std::move(primary_key_p)) {
+}
+
+bool MySQLCachedTable::IsCurrent() const {
+	if (!data || invalidated) {
+		return false;
+	}
+	auto age = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - refreshed).count();
+	return age >= 0 && idx_t(age) < refresh_seconds;
+}
+
+static bool UseBackgroundRefresh(ClientContext &context) {
+	Value background_refresh;
+	if (!context.TryGetCurrentSetting("mysql_cached_table_background_refresh", background_refresh)) {
+		return true;
+	}
+	return BooleanValue::Get(background_refresh);
+}
+
+shared_ptr<MySQLCachedTableData> MySQLCachedTable::GetData(ClientContext &context, MySQLCatalog &catalog) {
+	auto background_refresh = UseBackgroundRefresh(context);
+	{
+		lock_guard<mutex> l(lock);
+		if (IsCurrent()) {
+			return data;
+		}
+		if (data && !invalidated && background_refresh && (refresh_scheduled || ScheduleRefresh(context, catalog))) {
+			// the rows have expired, but are not outdated by a write - the query does not wait for the refresh
+			return data;
+		}
+	}
+	unique_lock<mutex> refresh_guard(refresh_lock, std::defer_lock);
+	if (!refresh_guard.try_lock()) {
+		{
+			// another query is refreshing the table - use the previous rows unless they are outdated by a write
+			lock_guard<mutex> l(lock);
+			if (data && !invalidated) {
+				return data;
+			}
+		}
+		refresh_guard.lock();
+	}
+	bool full;
+	{
+		// the table may have been refreshed while waiting for the refresh lock
+		lock_guard<mutex> l(lock);
+		if (IsCurrent()) {
+			return data;
+		}
+		full = !data || invalidated;
+	}
+	Refresh(context, catalog, full);
+	lock_guard<mutex> l(lock);
+	return data;
+}
+
+//! Refreshes a cached table on a background thread of the scheduler
+class MySQLCachedTableRefreshTask : public Task {
+public:
+	MySQLCachedTableRefreshTask(shared_ptr<MySQLCachedTable> table_p, DatabaseInstance &db, string catalog_name_p)
+	    : table(std::move(table_p)), db(db), catalog_name(std::move(catalog_name_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		table->RefreshInBackground(db, catalog_name);
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<MySQLCachedTable> table;
+	//! Tasks are finished (or dropped) before the database instance is destroyed
+	DatabaseInstance &db;
+	//! The attached database is looked up again when the task runs - it may have been detached in the meantime
+	string catalog_name;
+};
+
+bool MySQLCachedTable::ScheduleRefresh(ClientContext &context, MySQLCatalog &catalog) {
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (scheduler.NumberOfThreads() <= 1) {
+		// without background threads tasks are only run by the executors of queries - which only run their own tasks
+		return false;
+	}
+	auto &db = DatabaseInstance::GetDatabase(context);
+	auto producer = scheduler.CreateProducer();
+	scheduler.ScheduleTask(*producer, make_shared_ptr<MySQLCachedTableRefreshTask>(shared_from_this(), db,
+	                                                                             catalog.GetName()));
+	refresh_scheduled = true;
+	return true;
+}
+
+void MySQLCachedTable::RefreshInBackground(DatabaseInstance &db, const string &catalog_name) {
+	bool refreshed_rows = false;
+	try {
+		Connection con(db);
+		auto &context = *con.context;
+		context.RunFunctionInTransaction([&]() {
+			auto &catalog = Catalog::GetCatalog(context, catalog_name);
+			if (catalog.GetCatalogType() != "mysql") {
+				return;
+			}
+			auto &mysql_catalog = catalog.Cast<MySQLCatalog>();
+			if (mysql_catalog.GetCachedTables().Find(schema_name, table_name).get() != this) {
+				// the table is no longer cached (or has been cached again with a different configuration)
+				return;
+			}
+			lock_guard<mutex> refresh_guard(refresh_lock);
+			bool full;
+			{
+				lock_guard<mutex> l(lock);
+				if (IsCurrent()) {
+					return;
+				}
+				full = !data || invalidated;
+			}
+			Refresh(context, mysql_catalog, full);
+			refreshed_rows = true;
+		});
+	} catch (std::exception &) {
+		// e.g. MySQL cannot be reached - the previous rows are used until the next refresh interval has passed
+	}
+	lock_guard<mutex> l(lock);
+	refresh_scheduled = false;
+	if (!refreshed_rows) {
+		refreshed = std::chrono::steady_clock::now();
+	}
+}
+
+void MySQLCachedTable::Invalidate() {
+	lock_guard<mutex> l(lock);
+	invalidated = true;
+	invalidations++;
+}
+
+//! Returns the values of a row as text
+static string GetRowText(DataChunk &chunk, idx_t row) {
+	string result;
+	for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+		if (c > 0) {
+			result += ",";
+		}
+		result += chunk.GetValue(c, row).ToSQLString();
+	}
+	return result;
+}
+
+//! Whether or not all rows read by a refresh are already part of the rows - i.e. they are the unchanged rows with the
+//! highest watermark. Only the row groups that contain the highest watermark are compared.
+static bool ContainsRows(MySQLCachedTableData &rows, MySQLCachedTableData &changed_rows, idx_t watermark_index,
+                         const Value &high_watermark) {
+	if (rows.names != changed_rows.names || rows.types != changed_rows.types) {
+		return false;
+	}
+	unordered_set<string> remaining_rows;
+	for (auto &row_group : changed_rows.row_groups) {
+		for (auto &chunk : row_group.rows->Chunks()) {
+			for (idx_t r = 0; r < chunk.size(); r++) {
+				if (chunk.GetValue(watermark_index, r) != high_watermark) {
+					return false;
+				}
+				remaining_rows.insert(GetRowText(chunk, r));
+			}
+		}
+	}
+	for (auto &row_group : rows.row_groups) {
+		if (remaining_rows.empty()) {
+			break;
+		}
+		auto &stats = row_group.statistics[watermark_index];
+		if (!NumericStats::HasMax(stats) || NumericStats::Max(stats) < high_watermark) {
+			continue;
+		}
+		for (auto &chunk : row_group.rows->Chunks()) {
+			for (idx_t r = 0; r < chunk.size(); r++) {
+				if (chunk.GetValue(watermark_index, r) == high_watermark) {
+					remaining_rows.erase(GetRowText(chunk, r));
+				}
+			}
+		}
+	}
+	return remaining_rows.empty();
+}
+
+void MySQLCachedTable::Refresh(ClientContext &context, MySQLCatalog &catalog, bool full) {
+	shared_ptr<MySQLCachedTableData> current;
+	idx_t start_invalidations;
+	{
+		lock_guard<mutex> l(lock);
+		current = data;
+		start_invalidations = invalidations;
+	}
+	shared_ptr<MySQLCachedTableData> new_data;
+	string new_checksum;
+	if (!watermark_column.empty()) {
+		auto watermark_index = current ? current->GetColumnIndex(watermark_column) : DConstants::INVALID_INDEX;
+		auto high_watermark =
+		    watermark_index == DConstants::INVALID_INDEX ? Value() : current->GetMaximum(watermark_index);
+		if (!full && !high_watermark.IsNull()) {
+			// only read the rows that have been inserted or updated since the last refresh - including the rows with
+			// the highest watermark, as rows with the same value can be committed after the previous refresh
+			auto changed_rows = LoadRows(context, catalog,
+			                             KeywordHelper::WriteQuoted(watermark_column, '"') +
+			                                 " >= " + high_watermark.ToSQLString());
+			new_data = ContainsRows(*current, *changed_rows, watermark_index, high_watermark)
+			               ? current
+			               : MergeRows(*current, *changed_rows);
+		}
+	} else {
+		// the checksum is computed before the rows are read - if the table changes in between, the next refresh
+		// reads the table again
+		new_checksum = GetChecksum(context, catalog);
+		if (!full && !new_checksum.empty() && new_checksum == checksum) {
+			new_data = current;
+		}
+	}
+	if (!new_data) {
+		new_data = LoadRows(context, catalog, string());
+	}
+	lock_guard<mutex> l(lock);
+	data = std::move(new_data);
+	refreshed = std::chrono::steady_clock::now();
+	checksum = std::move(new_checksum);
+	if (invalidations == start_invalidations) {
+		invalidated = false;
+	}
+}
+
+shared_ptr<MySQLCachedTableData> MySQLCachedTable::LoadRows(ClientContext &context, MySQLCatalog &catalog,
+                                                            const string &condition) {
+	// the rows are read through DuckDB - so that they are decoded (and filters are pushed down) as in regular scans
+	Connection con(DatabaseInstance::GetDatabase(context));
+	auto setting_result = con.Query("SET SESSION mysql_use_cached_tables=false");
+	if (setting_result->HasError()) {
+		setting_result->ThrowError();
+	}
+	auto query = "SELECT * FROM " + KeywordHelper::WriteQuoted(catalog.GetName(), '"') + "." +
+	             KeywordHelper::WriteQuoted(schema_name, '"') + "." + KeywordHelper::WriteQuoted(table_name, '"');
+	if (!condition.empty()) {
+		query += " WHERE " + condition;
+	}
+	auto result = con.SendQuery(query);
+	if (result->HasError()) {
+		result->ThrowError();
+	}
+	auto rows = make_shared_ptr<MySQLCachedTableData>(result->names, result->types);
+	while (true) {
+		auto chunk = result->Fetch();
+		if (result->HasError()) {
+			result->ThrowError();
+		}
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+		rows->Append(*chunk);
+	}
+	return rows;
+}
+
+//! Returns the primary key of a row as text - the values are quoted, so that different keys never have the same text
+static string GetRowKey(DataChunk &chunk, const vector<idx_t> &key_columns, idx_t row) {
+	string result;
+	for (auto &column_index : key_columns) {
+		if (!result.empty()) {
+			result += ",";
+		}
+		result += chunk.GetValue(column_index, row).ToSQLString();
+	}
+	return result;
+}
+
+shared_ptr<MySQLCachedTableData> MySQLCachedTable::MergeRows(MySQLCachedTableData &rows,
+                                                             MySQLCachedTableData &changed_rows) {
+	if (rows.names != changed_rows.names || rows.types != changed_rows.types) {
+		// the columns of the table have changed - the table is read again entirely
+		return nullptr;
+	}
+	vector<idx_t> key_columns;
+	for (auto &key_column : primary_key) {
+		auto column_index = rows.GetColumnIndex(key_column);
+		if (column_index == DConstants::INVALID_INDEX) {
+			return nullptr;
+		}
+		key_columns.push_back(column_index);
+	}
+	unordered_set<string> changed_keys;
+	for (auto &row_group : changed_rows.row_groups) {
+		for (auto &chunk : row_group.rows->Chunks()) {
+			for (idx_t r = 0; r < chunk.size(); r++) {
+				changed_keys.insert(GetRowKey(chunk, key_columns, r));
+			}
+		}
+	}
+	// the changed rows replace the rows with the same primary key - rows that were deleted in MySQL are kept
+	auto result = make_shared_ptr<MySQLCachedTableData>(rows.names, rows.types);
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	for (auto &row_group : rows.row_groups) {
+		for (auto &chunk : row_group.rows->Chunks()) {
+			idx_t count = 0;
+			for (idx_t r = 0; r < chunk.size(); r++) {
+				if (changed_keys.find(GetRowKey(chunk, key_columns, r)) == changed_keys.end()) {
+					sel.set_index(count++, r);
+				}
+			}
+			if (count < chunk.size()) {
+				chunk.Slice(sel, count);
+			}
+			result->Append(chunk);
+		}
+	}
+	for (auto &row_group : changed_rows.row_groups) {
+		for (auto &chunk : row_group.rows->Chunks()) {
+			result->Append(chunk);
+		}
+	}
+	return result;
+}
+
+string MySQLCachedTable::GetChecksum(ClientContext &context, MySQLCatalog &catalog) {
+	auto &pool = catalog.GetConnectionPool();
+	auto con = pool.Acquire(context);
+	auto result = con.Query("CHECKSUM TABLE " + MySQLUtils::WriteIdentifier(schema_name) + "." +
+	                            MySQLUtils::WriteIdentifier(table_name),
+	                        context);
+	string table_checksum;
+	// the checksum is NULL if the table does not exist
+	if (result->Next() && !result->IsNull(1)) {
+		table_checksum = result->GetString(1);
+	}
+	result.reset();
+	pool.Release(std::move(con));
+	return table_checksum;
+}
+
+//===--------------------------------------------------------------------===//
+// Cached Tables
+//===--------------------------------------------------------------------===//
+void MySQLCachedTables::Add(shared_ptr<MySQLCachedTable> table) {
+	auto key = MySQLResultCache::GetTableKey(table->schema_name, table->table_name);
+	lock_guard<mutex> l(lock);
+	tables[key] = std::move(table);
+}
+
+bool MySQLCachedTables::Remove(const string &schema_name, const string &table_name) {
+	lock_guard<mutex> l(lock);
+	return tables.erase(MySQLResultCache::GetTableKey(schema_name, table_name)) > 0;
+}
+
+shared_ptr<MySQLCachedTable> MySQLCachedTables::Find(const string &schema_name, const string &table_name) {
+	lock_guard<mutex> l(lock);
+	auto entry = tables.find(MySQLResultCache::GetTableKey(schema_name, table_name));
+	if (entry == tables.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+void MySQLCachedTables::InvalidateTable(const string &schema_name, const string &table_name) {
+	auto table = Find(schema_name, table_name);
+	if (table) {
+		table->Invalidate();
+	}
+}
+
+void MySQLCachedTables::InvalidateAll() {
+	lock_guard<mutex> l(lock);
+	for (auto &entry : tables) {
+		entry.second->Invalidate();
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// mysql_cached_scan
+//===--------------------------------------------------------------------===//
+MySQLCachedScanBindData::MySQLCachedScanBindData(MySQLTableEntry &table, shared_ptr<MySQLCachedTableData> data_p)
+    : table(table), data(std::move(data_p)), row_id_index(DConstants::INVALID_INDEX) {
+	auto row_id_column = table.GetRowIdColumn();
+	if (!row_id_column.empty()) {
+		row_id_index = data->GetColumnIndex(row_id_column);
+	}
+}
+
+struct MySQLCachedScanGlobalState : public GlobalTableFunctionState {
+	explicit MySQLCachedScanGlobalState(idx_t max_threads) : next_row_group(0), max_threads(max_threads) {
+	}
+
+	atomic<idx_t> next_row_group;
+	idx_t max_threads;
+	vector<column_t> column_ids;
+	optional_ptr<TableFilterSet> filters;
+	//! The filters of the scan as a single expression over the scanned columns - or nullptr if there are none
+	unique_ptr<Expression> filter_expression;
+	//! The columns of the cached rows that are scanned
+	vector<column_t> scan_column_ids;
+	vector<LogicalType> scan_types;
+	//! The position in the scanned columns of every column of the scan - or INVALID_INDEX for a NULL row id
+	vector<idx_t> scan_positions;
+
+	idx_t MaxThreads() const override {
+		return max_threads;
+	}
+};
+
+struct MySQLCachedScanLocalState : public LocalTableFunctionState {
+	MySQLCachedScanLocalState() : row_ids(LogicalType::ROW_TYPE), sel(STANDARD_VECTOR_SIZE) {
+	}
+
+	optional_ptr<MySQLCachedRowGroup> row_group;
+	ColumnDataScanState scan_state;
+	DataChunk scan_chunk;
+	Vector row_ids;
+	unique_ptr<ExpressionExecutor> executor;
+	SelectionVector sel;
+};
+
+static unique_ptr<GlobalTableFunctionState> MySQLCachedScanInitGlobal(ClientContext &context,
+                                                                      TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<MySQLCachedScanBindData>();
+	auto &data = *bind_data.data;
+	auto result = make_uniq<MySQLCachedScanGlobalState>(MaxValue<idx_t>(data.row_groups.size(), 1));
+	result->column_ids = input.column_ids;
+	result->filters = input.filters;
+	vector<LogicalType> output_types;
+	for (auto &column_id : input.column_ids) {
+		auto data_column = column_id == COLUMN_IDENTIFIER_ROW_ID ? bind_data.row_id_index : column_id;
+		output_types.push_back(column_id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::ROW_TYPE : data.types[column_id]);
+		if (data_column == DConstants::INVALID_INDEX) {
+			result->scan_positions.push_back(DConstants::INVALID_INDEX);
+			continue;
+		}
+		idx_t position;
+		for (position = 0; position < result->scan_column_ids.size(); position++) {
+			if (result->scan_column_ids[position] == data_column) {
+				break;
+			}
+		}
+		if (position == result->scan_column_ids.size()) {
+			result->scan_column_ids.push_back(data_column);
+			result->scan_types.push_back(data.types[data_column]);
+		}
+		result->scan_positions.push_back(position);
+	}
+	if (input.filters) {
+		vector<unique_ptr<Expression>> filter_expressions;
+		for (auto &entry : input.filters->filters) {
+			auto &filter = *entry.second;
+			if (filter.filter_type == TableFilterType::OPTIONAL_FILTER ||
+			    filter.filter_type == TableFilterType::DYNAMIC_FILTER) {
+				// these only allow skipping rows early - DuckDB evaluates the filters they are derived from
+				continue;
+			}
+			BoundReferenceExpression column_ref(output_types[entry.first], entry.first);
+			filter_expressions.push_back(filter.ToExpression(column_ref));
+		}
+		if (filter_expressions.size() == 1) {
+			result->filter_expression = std::move(filter_expressions[0]);
+		} else if (!filter_expressions.empty()) {
+			auto conjunction = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+			conjunction->children = std::move(filter_expressions);
+			result->filter_expression = std::move(conjunction);
+		}
+	}
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> MySQLCachedScanInitLocal(ExecutionContext &context,
+                                                                    TableFunctionInitInput &input,
+                                                                    GlobalTableFunctionState *global_state) {
+	auto &gstate = global_state->Cast<MySQLCachedScanGlobalState>();
+	auto result = make_uniq<MySQLCachedScanLocalState>();
+	result->scan_chunk.Initialize(Allocator::DefaultAllocator(), gstate.scan_types);
+	if (gstate.filter_expression) {
+		result->executor = make_uniq<ExpressionExecutor>(context.client, *gstate.filter_expression);
+	}
+	return std::move(result);
+}
+
+//! Whether or not the rows of a row group can match the filters of the scan according to the statistics of its columns
+static bool RowGroupMayMatch(MySQLCachedScanGlobalState &gstate, MySQLCachedRowGroup &row_group) {
+	if (!gstate.filters) {
+		return true;
+	}
+	for (auto &entry : gstate.filters->filters) {
+		auto column_id = gstate.column_ids[entry.first];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto result = entry.second->CheckStatistics(row_group.statistics[column_id]);
+		if (result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool NextRowGroup(MySQLCachedScanGlobalState &gstate, MySQLCachedScanLocalState &lstate,
+                         MySQLCachedTableData &data) {
+	while (true) {
+		auto index = gstate.next_row_group++;
+		if (index >= data.row_groups.size()) {
+			return false;
+		}
+		auto &row_group = data.row_groups[index];
+		if (!RowGroupMayMatch(gstate, row_group)) {
+			continue;
+		}
+		lstate.row_group = &row_group;
+		row_group.rows->InitializeScan(lstate.scan_state, gstate.scan_column_ids);
+		return true;
+	}
+}
+
+static void MySQLCachedScan(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<MySQLCachedScanBindData>();
+	auto &gstate = data_p.global_state->Cast<MySQLCachedScanGlobalState>();
+	auto &lstate = data_p.local_state->Cast<MySQLCachedScanLocalState>();
+	while (true) {
+		if (!lstate.row_group && !NextRowGroup(gstate, lstate, *bind_data.data)) {
+			return;
+		}
+		if (!lstate.row_group->rows->Scan(lstate.scan_state, lstate.scan_chunk)) {
+			lstate.row_group = nullptr;
+			continue;
+		}
+		output.Reset();
+		auto count = lstate.scan_chunk.size();
+		for (idx_t c = 0; c < gstate.column_ids.size(); c++) {
+			auto position = gstate.scan_positions[c];
+			if (position == DConstants::INVALID_INDEX) {
+				output.data[c].SetVectorType(VectorType::CONSTANT_VECTOR);
+				ConstantVector::SetNull(output.data[c], true);
+			} else if (gstate.column_ids[c] == COLUMN_IDENTIFIER_ROW_ID) {
+				VectorOperations::DefaultCast(lstate.scan_chunk.data[position], lstate.row_ids, count);
+				output.data[c].Reference(lstate.row_ids);
+			} else {
+				output.data[c].Reference(lstate.scan_chunk.data[position]);
+			}
+		}
+		output.SetCardinality(count);
+		if (lstate.executor) {
+			auto match_count = lstate.executor->SelectExpression(output, lstate.sel);
+			if (match_count < count) {
+				output.Slice(lstate.sel, match_count);
+			}
+		}
+		if (output.size() > 0) {
+			return;
+		}
+	}
+}
+
+static unique_ptr<NodeStatistics> MySQLCachedScanCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<MySQLCachedScanBindData>();
+	return make_uniq<NodeStatistics>(bind_data.data->count, bind_data.data->count);
+}
+
+static InsertionOrderPreservingMap<string> MySQLCachedScanToString(TableFunctionToStringInput &input) {
+	InsertionOrderPreservingMap<string> result;
+	auto &bind_data = input.bind_data->Cast<MySQLCachedScanBindData>();
+	result["Table"] = bind_data.table.name;
+	result["Cached Rows"] = to_string(bind_data.data->count);
+	return result;
+}
+
+static BindInfo MySQLCachedScanGetBindInfo(const optional_ptr<FunctionData> bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<MySQLCachedScanBindData>();
+	BindInfo info(ScanType::EXTERNAL);
+	info.table = bind_data.table;
+	return info;
+}
+
+MySQLCachedScanFunction::MySQLCachedScanFunction()
+    : TableFunction("mysql_cached_scan", {}, MySQLCachedScan, nullptr, MySQLCachedScanInitGlobal,
+                    MySQLCachedScanInitLocal) {
+	to_string = MySQLCachedScanToString;
+	cardinality = MySQLCachedScanCardinality;
+	get_bind_info = MySQLCachedScanGetBindInfo;
+	projection_pushdown = true;
+	filter_pushdown = true;
+}
+
+//===--------------------------------------------------------------------===//
+// mysql_cache_table / mysql_uncache_table
+//===--------------------------------------------------------------------===//
+struct CacheTableFunctionData : public TableFunctionData {
+	explicit CacheTableFunctionData(MySQLCatalog &catalog) : catalog(catalog) {
+	}
+
+	MySQLCatalog &catalog;
+	string schema_name;
+	string table_name;
+	//! The table that is cached - nullptr for mysql_uncache_table
+	shared_ptr<MySQLCachedTable> cached_table;
+	bool finished = false;
+};
+
+static unique_ptr<CacheTableFunctionData> BindCacheTarget(ClientContext &context, TableFunctionBindInput &input,
+                                                          const string &function_name,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[0].IsNull()) {
+		throw BinderException("%s: the table cannot be NULL", function_name);
+	}
+	auto target = input.inputs[0].GetValue<string>();
+	auto parts = StringUtil::Split(target, '.');
+	if (parts.size() < 2 || parts.size() > 3) {
+		throw BinderException("%s: expected a table of the form \"database[.schema].table\" - got \"%s\"",
+		                      function_name, target);
+	}
+	auto db = DatabaseManager::Get(context).GetDatabase(context, parts[0]);
+	if (!db || db->GetCatalog().GetCatalogType() != "mysql") {
+		throw BinderException("%s: \"%s\" is not an attached MySQL database", function_name, parts[0]);
+	}
+	auto result = make_uniq<CacheTableFunctionData>(db->GetCatalog().Cast<MySQLCatalog>());
+	result->schema_name = parts.size() == 3 ? parts[1] : string(DEFAULT_SCHEMA);
+	result->table_name = parts.back();
+	return_types.push_back(LogicalType::BOOLEAN);
+	names.emplace_back("Success");
+	return result;
+}
+
+static unique_ptr<FunctionData> CacheTableBind(ClientContext &context, TableFunctionBindInput &input,
+                                               vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = BindCacheTarget(context, input, "mysql_cache_table", return_types, names);
+	auto &table = result->catalog.GetEntry<TableCatalogEntry>(context, result->schema_name, result->table_name)
+	                  .Cast<MySQLTableEntry>();
+	idx_t refresh_seconds = 300;
+	string watermark_column;
+	for (auto &entry : input.named_parameters) {
+		if (entry.second.IsNull()) {
+			throw BinderException("mysql_cache_table: \"%s\" cannot be NULL", entry.first);
+		}
+		if (entry.first == "refresh") {
+			auto micros = Interval::GetMicro(IntervalValue::Get(entry.second));
+			if (micros < 0) {
+				throw BinderException("mysql_cache_table: the refresh interval cannot be negative");
+			}
+			refresh_seconds = idx_t(micros / Interval::MICROS_PER_SEC);
+		} else if (entry.first == "watermark") {
+			auto column_name = StringValue::Get(entry.second);
+			if (!table.ColumnExists(column_name)) {
+				throw BinderException("Table \"%s\" does not have a column named \"%s\"", table.name, column_name);
+			}
+			auto &column = table.GetColumn(column_name);
+			auto &type = column.GetType();
+			if (!type.IsIntegral() && type.id() != LogicalTypeId::DECIMAL && type.id() != LogicalTypeId::DATE &&
+			    type.id() != LogicalTypeId::TIMESTAMP && type.id() != LogicalTypeId::TIMESTAMP_TZ) {
+				throw BinderException("Column \"%s\" of type %s cannot be used as watermark - mysql_cache_table "
+				                      "requires an integer, decimal, date or timestamp column",
+				                      column.GetName(), type.ToString());
+			}
+			if (table.primary_key.empty()) {
+				throw BinderException("mysql_cache_table: table \"%s\" has no primary key - refreshing by watermark "
+				                      "requires a primary key to replace the rows that have changed",
+				                      table.name);
+			}
+			watermark_column = column.GetName();
+		}
+	}
+	result->schema_name = table.schema.name;
+	result->table_name = table.name;
+	result->cached_table = make_shared_ptr<MySQLCachedTable>(table.schema.name, table.name, refresh_seconds,
+	                                                         std::move(watermark_column), table.primary_key);
+	return std::move(result);
+}
+
+static void CacheTableFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<CacheTableFunctionData>();
+	if (data.finished) {
+		return;
+	}
+	data.finished = true;
+	// the table is loaded right away - instead of by the first query that scans it
+	data.cached_table->GetData(context, data.catalog);
+	data.catalog.GetCachedTables().Add(data.cached_table);
+	output.SetValue(0, 0, Value::BOOLEAN(true));
+	output.SetCardinality(1);
+}
+
+static unique_ptr<FunctionData> UncacheTableBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	return BindCacheTarget(context, input, "mysql_uncache_table", return_types, names);
+}
+
+static void UncacheTableFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<CacheTableFunctionData>();
+	if (data.finished) {
+		return;
+	}
+	data.finished = true;
+	auto removed = data.catalog.GetCachedTables().Remove(data.schema_name, data.table_name);
+	output.SetValue(0, 0, Value::BOOLEAN(removed));
+	output.SetCardinality(1);
+}
+
+MySQLCacheTableFunction::MySQLCacheTableFunction()
+    : TableFunction("mysql_cache_table", {LogicalType::VARCHAR}, CacheTableFunction, CacheTableBind) {
+	named_parameters["refresh"] = LogicalType::INTERVAL;
+	named_parameters["watermark"] = LogicalType::VARCHAR;
+}
+
+MySQLUncacheTableFunction::MySQLUncacheTableFunction()
+    : TableFunction("mysql_uncache_table", {LogicalType::VARCHAR}, UncacheTableFunction, UncacheTableBind) {
+}
+
+} // namespace duckdb
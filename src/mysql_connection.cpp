@@ -3,6 +3,7 @@
 #include "duckdb/parser/parser.hpp"
 #include "mysql_connection.hpp"
 #include "duckdb/common/types/uuid.hpp"
+#include "errmsg.h"
 
 namespace duckdb {
 
@@ -18,11 +19,13 @@ MySQLConnection::~MySQLConnection() {
 MySQLConnection::MySQLConnection(MySQLConnection &&other) noexcept {
 	std::swap(connection, other.connection);
 	std::swap(dsn, other.dsn);
+	std::swap(queued_statements, other.queued_statements);
 }
 
 MySQLConnection &MySQLConnection::operator=(MySQLConnection &&other) noexcept {
 	std::swap(connection, other.connection);
 	std::swap(dsn, other.dsn);
+	std::swap(queued_statements, other.queued_statements);
 	return *this;
 }
 
@@ -33,22 +36,60 @@ MySQLConnection MySQLConnection::Open(const string &connection_string) {
 	return result;
 }
 
-MYSQL_RES *MySQLConnection::MySQLExecute(const string &query) {
+void MySQLConnection::SendQuery(MYSQL *con, const string &query) {
+	auto queued = std::move(queued_statements);
+	queued_statements.clear();
+	string full_query;
+	for (auto &statement : queued) {
+		full_query += statement + "; ";
+	}
+	full_query += query;
 	if (MySQLConnection::DebugPrintQueries()) {
-		Printer::Print(query + "\n");
+		Printer::Print(full_query + "\n");
+	}
+	int res = mysql_real_query(con, full_query.c_str(), full_query.size());
+	if (res != 0) {
+		throw IOException("Failed to run query \"%s\": %s\n", full_query.c_str(), mysql_error(con));
 	}
+	// the queued statements come first - skip over their (empty) results
+	for (idx_t i = 0; i < queued.size(); i++) {
+		auto result = mysql_store_result(con);
+		if (result) {
+			mysql_free_result(result);
+		}
+		auto status = mysql_next_result(con);
+		if (status > 0) {
+			throw IOException("Failed to run query \"%s\": %s\n", full_query.c_str(), mysql_error(con));
+		}
+		if (status < 0) {
+			throw InternalException("MySQLConnection::SendQuery - missing result for query \"%s\"", full_query);
+		}
+	}
+}
+
+MYSQL_RES *MySQLConnection::MySQLExecute(const string &query, bool streaming) {
 	auto con = GetConn();
 	lock_guard<mutex> l(query_lock);
-	int res = mysql_real_query(con, query.c_str(), query.size());
-	if (res != 0) {
-		throw IOException("Failed to run query \"%s\": %s\n", query.c_str(), mysql_error(con));
+	SendQuery(con, query);
+	if (streaming) {
+		return mysql_use_result(con);
 	}
 	return mysql_store_result(con);
 }
 
-unique_ptr<MySQLResult> MySQLConnection::Query(const string &query, optional_ptr<ClientContext> context) {
-	auto con = GetConn();
-	auto result = MySQLExecute(query);
+static void SetFieldOrigin(MySQLField &mysql_field, const MYSQL_FIELD &field) {
+	if (!field.org_table || field.org_table_length == 0 || !field.org_name || field.org_name_length == 0) {
+		return;
+	}
+	if (field.db && field.db_length > 0) {
+		mysql_field.base_schema = string(field.db, field.db_length);
+	}
+	mysql_field.base_table = string(field.org_table, field.org_table_length);
+	mysql_field.base_column = string(field.org_name, field.org_name_length);
+}
+
+unique_ptr<MySQLResult> MySQLConnection::MakeResult(MYSQL *con, MYSQL_RES *result, const string &query,
+                                                    optional_ptr<ClientContext> context, bool streaming) {
 	auto field_count = mysql_field_count(con);
 	if (!result) {
 		// no result set
@@ -62,8 +103,10 @@ unique_ptr<MySQLResult> MySQLConnection::Query(const string &query, optional_ptr
 		return make_uniq<MySQLResult>(mysql_affected_rows(con));
 	} else {
 		// result set
+		// streaming results keep the connection alive, as rows are fetched from it lazily
+		auto streaming_connection = streaming ? connection : nullptr;
 		if (!context) {
-			return make_uniq<MySQLResult>(result, field_count);
+			return make_uniq<MySQLResult>(result, field_count, std::move(streaming_connection));
 		}
 		vector<MySQLField> fields;
 		for (idx_t i = 0; i < field_count; i++) {
@@ -72,12 +115,212 @@ unique_ptr<MySQLResult> MySQLConnection::Query(const string &query, optional_ptr
 			if (field->name && field->name_length > 0) {
 				mysql_field.name = string(field->name, field->name_length);
 			}
-			mysql_field.type = MySQLUtils::FieldToLogicalType(*context, field);
+			mysql_field.type = MySQLUtils::FieldToLogicalType(*context, field, streaming);
+			SetFieldOrigin(mysql_field, *field);
 			fields.push_back(std::move(mysql_field));
 		}
 
-		return make_uniq<MySQLResult>(result, std::move(fields));
+		return make_uniq<MySQLResult>(result, std::move(fields), std::move(streaming_connection));
+	}
+}
+
+unique_ptr<MySQLResult> MySQLConnection::Query(const string &query, optional_ptr<ClientContext> context,
+                                               bool streaming) {
+	auto con = GetConn();
+	auto result = MySQLExecute(query, streaming);
+	return MakeResult(con, result, query, context, streaming);
+}
+
+vector<unique_ptr<MySQLResult>> MySQLConnection::QueryMultiple(const vector<string> &queries) {
+	vector<unique_ptr<MySQLResult>> results;
+	if (queries.empty()) {
+		return results;
+	}
+	auto con = GetConn();
+	lock_guard<mutex> l(query_lock);
+	SendQuery(con, StringUtil::Join(queries, "; "));
+	for (idx_t i = 0; i < queries.size(); i++) {
+		if (i > 0) {
+			auto status = mysql_next_result(con);
+			if (status > 0) {
+				throw IOException("Failed to run query \"%s\": %s\n", queries[i].c_str(), mysql_error(con));
+			}
+			if (status < 0) {
+				throw InternalException("MySQLConnection::QueryMultiple - missing result for query \"%s\"",
+				                        queries[i]);
+			}
+		}
+		results.push_back(MakeResult(con, mysql_store_result(con), queries[i], nullptr, false));
+	}
+	return results;
+}
+
+void MySQLConnection::QueueStatement(string statement) {
+	lock_guard<mutex> l(query_lock);
+	queued_statements.push_back(std::move(statement));
+}
+
+void MySQLConnection::FlushQueuedStatements() {
+	string statement;
+	{
+		lock_guard<mutex> l(query_lock);
+		if (queued_statements.empty()) {
+			return;
+		}
+		// send the last queued statement as the query - the others are sent along with it
+		statement = std::move(queued_statements.back());
+		queued_statements.pop_back();
+	}
+	Execute(statement);
+}
+
+unique_ptr<MySQLStatement> MySQLConnection::QueryPrepared(const string &query, const vector<LogicalType> &types,
+                                                          bool streaming, const vector<Value> &parameters,
+                                                          idx_t cache_size) {
+	// prepared statements cannot be part of a multi-statement request
+	FlushQueuedStatements();
+	if (MySQLConnection::DebugPrintQueries()) {
+		Printer::Print(query + "\n");
+	}
+	auto con = GetConn();
+	lock_guard<mutex> l(query_lock);
+	auto stmt = cache_size > 0 ? connection->statement_cache.Take(query) : nullptr;
+	auto prepared = stmt != nullptr;
+	if (!prepared) {
+		stmt = mysql_stmt_init(con);
+		if (!stmt) {
+			throw IOException("Failed to initialize prepared statement: %s\n", mysql_error(con));
+		}
+	}
+	auto result = make_uniq<MySQLStatement>(connection, stmt, query);
+	if (!prepared && mysql_stmt_prepare(stmt, query.c_str(), query.size()) != 0) {
+		throw IOException("Failed to prepare query \"%s\": %s\n", query.c_str(), mysql_stmt_error(stmt));
+	}
+	result->KeepPrepared(cache_size);
+	result->Execute(types, streaming, parameters);
+	return result;
+}
+
+bool MySQLConnection::TryGetQueryFields(ClientContext &context, const string &query, vector<MySQLField> &fields) {
+	FlushQueuedStatements();
+	auto con = GetConn();
+	lock_guard<mutex> l(query_lock);
+	auto stmt = mysql_stmt_init(con);
+	if (!stmt) {
+		throw IOException("Failed to initialize prepared statement: %s\n", mysql_error(con));
 	}
+	if (mysql_stmt_prepare(stmt, query.c_str(), query.size()) != 0) {
+		// not all statements can be prepared - the error (if any) is reported when the query is run
+		mysql_stmt_close(stmt);
+		return false;
+	}
+	auto metadata = mysql_stmt_result_metadata(stmt);
+	if (!metadata) {
+		// the statement does not return a result set
+		mysql_stmt_close(stmt);
+		return false;
+	}
+	auto field_count = mysql_num_fields(metadata);
+	for (idx_t i = 0; i < field_count; i++) {
+		auto field = mysql_fetch_field_direct(metadata, i);
+		MySQLField mysql_field;
+		if (field->name && field->name_length > 0) {
+			mysql_field.name = string(field->name, field->name_length);
+		}
+		// max_length is not known before running the query - use the declared length
+		mysql_field.type = MySQLUtils::FieldToLogicalType(context, field, true);
+		SetFieldOrigin(mysql_field, *field);
+		fields.push_back(std::move(mysql_field));
+	}
+	mysql_free_result(metadata);
+	mysql_stmt_close(stmt);
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// LOAD DATA LOCAL INFILE
+//===--------------------------------------------------------------------===//
+struct MySQLLocalInfileData {
+	const_data_ptr_t data;
+	idx_t size;
+	idx_t position;
+};
+
+static int MySQLLocalInfileInit(void **ptr, const char *filename, void *userdata) {
+	// the file name sent by the server is ignored - we always feed the in-memory buffer instead
+	*ptr = userdata;
+	return 0;
+}
+
+static int MySQLLocalInfileRead(void *ptr, char *buf, unsigned int buf_len) {
+	auto &infile = *reinterpret_cast<MySQLLocalInfileData *>(ptr);
+	auto read_size = MinValue<idx_t>(buf_len, infile.size - infile.position);
+	memcpy(buf, infile.data + infile.position, read_size);
+	infile.position += read_size;
+	return int(read_size);
+}
+
+static void MySQLLocalInfileEnd(void *ptr) {
+}
+
+static int MySQLLocalInfileError(void *ptr, char *error_msg, unsigned int error_msg_len) {
+	snprintf(error_msg, error_msg_len, "Failed to read in-memory LOAD DATA buffer");
+	return CR_UNKNOWN_ERROR;
+}
+
+idx_t MySQLConnection::LoadData(const string &query, const_data_ptr_t data, idx_t size) {
+	FlushQueuedStatements();
+	if (MySQLConnection::DebugPrintQueries()) {
+		Printer::Print(query + "\n");
+	}
+	auto con = GetConn();
+	idx_t affected_rows;
+	idx_t warning_count;
+	{
+		lock_guard<mutex> l(query_lock);
+		MySQLLocalInfileData infile {data, size, 0};
+		// only allow LOCAL INFILE for the duration of this query, and only from our in-memory handler
+		// (the capability itself has been announced when connecting, see MySQLUtils::Connect)
+		unsigned int local_infile = 1;
+		mysql_options(con, MYSQL_OPT_LOCAL_INFILE, &local_infile);
+		mysql_set_local_infile_handler(con, MySQLLocalInfileInit, MySQLLocalInfileRead, MySQLLocalInfileEnd,
+		                               MySQLLocalInfileError, &infile);
+		int res = mysql_real_query(con, query.c_str(), query.size());
+		local_infile = 0;
+		mysql_options(con, MYSQL_OPT_LOCAL_INFILE, &local_infile);
+		mysql_set_local_infile_default(con);
+		if (res != 0) {
+			throw IOException("Failed to run query \"%s\": %s\n", query.c_str(), mysql_error(con));
+		}
+		affected_rows = mysql_affected_rows(con);
+		warning_count = mysql_warning_count(con);
+	}
+	if (warning_count > 0) {
+		// with LOCAL the server turns errors (e.g. duplicate keys or invalid values) into warnings
+		// surface them as errors instead, as a regular INSERT would have failed
+		string message;
+		auto warnings = Query("SHOW WARNINGS LIMIT 1");
+		if (warnings->Next()) {
+			message = warnings->GetString(2);
+		}
+		throw IOException("Failed to run query \"%s\": %d warnings were reported while loading data: %s\n",
+		                  query.c_str(), warning_count, message);
+	}
+	return affected_rows;
+}
+
+idx_t MySQLConnection::GetMaxAllowedPacket() {
+	if (!connection) {
+		throw InternalException("MySQLConnection::GetMaxAllowedPacket - no connection available");
+	}
+	if (connection->max_allowed_packet == 0) {
+		auto result = Query("SELECT @@max_allowed_packet");
+		if (!result->Next()) {
+			throw IOException("Failed to fetch max_allowed_packet");
+		}
+		connection->max_allowed_packet = NumericCast<idx_t>(result->GetInt64(0));
+	}
+	return connection->max_allowed_packet;
 }
 
 void MySQLConnection::Execute(const string &query) {
@@ -95,10 +338,6 @@ void MySQLConnection::Close() {
 	connection = nullptr;
 }
 
-vector<IndexInfo> MySQLConnection::GetIndexInfo(const string &table_name) {
-	return vector<IndexInfo>();
-}
-
 void MySQLConnection::DebugSetPrintQueries(bool print) {
 	debug_mysql_print_queries = print;
 }
@@ -0,0 +1,121 @@
+#include "mysql_connection_pool.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+MySQLConnectionPoolConfig MySQLConnectionPoolConfig::FromContext(ClientContext &context) {
+	MySQLConnectionPoolConfig result;
+	Value setting;
+	if (context.TryGetCurrentSetting("mysql_connection_pool", setting)) {
+		result.enabled = BooleanValue::Get(setting);
+	}
+	if (context.TryGetCurrentSetting("mysql_connection_pool_min_size", setting)) {
+		result.min_size = UBigIntValue::Get(setting);
+	}
+	if (context.TryGetCurrentSetting("mysql_connection_pool_max_size", setting)) {
+		result.max_size = UBigIntValue::Get(setting);
+	}
+	if (context.TryGetCurrentSetting("mysql_connection_pool_idle_timeout", setting)) {
+		result.idle_timeout = UBigIntValue::Get(setting);
+	}
+	return result;
+}
+
+MySQLConnectionPool::MySQLConnectionPool(string connection_string_p) : connection_string(std::move(connection_string_p)) {
+}
+
+MySQLConnection MySQLConnectionPool::Acquire(ClientContext &context) {
+	{
+		lock_guard<mutex> l(lock);
+		config = MySQLConnectionPoolConfig::FromContext(context);
+	}
+	return Acquire();
+}
+
+MySQLConnection MySQLConnectionPool::Acquire() {
+	auto now = std::chrono::steady_clock::now();
+	while (true) {
+		IdleConnection idle;
+		{
+			lock_guard<mutex> l(lock);
+			CloseExpiredConnections(now);
+			if (idle_connections.empty()) {
+				break;
+			}
+			idle = std::move(idle_connections.back());
+			idle_connections.pop_back();
+		}
+		auto idle_seconds = std::chrono::duration_cast<std::chrono::seconds>(now - idle.idle_since).count();
+		if (idle_seconds < PING_AFTER_IDLE_SECONDS || mysql_ping(idle.connection.GetConn()) == 0) {
+			return std::move(idle.connection);
+		}
+		// the connection is no longer usable (e.g. closed by the server after wait_timeout) - try the next one
+	}
+	auto connection = MySQLConnection::Open(connection_string);
+	connection.GetConnection()->pool = weak_from_this();
+	return connection;
+}
+
+void MySQLConnectionPool::Release(MySQLConnection connection) {
+	auto owned_connection = connection.GetConnection();
+	if (!owned_connection || !owned_connection->connection) {
+		// closed connection
+		return;
+	}
+	if (owned_connection.use_count() > 2) {
+		// the connection is still in use elsewhere (e.g. by a streaming result)
+		return;
+	}
+	auto now = std::chrono::steady_clock::now();
+	lock_guard<mutex> l(lock);
+	if (!config.enabled || idle_connections.size() >= config.max_size) {
+		return;
+	}
+	IdleConnection idle;
+	idle.connection = std::move(connection);
+	idle.idle_since = now;
+	idle_connections.push_back(std::move(idle));
+	CloseExpiredConnections(now);
+}
+
+void MySQLConnectionPool::Clear() {
+	vector<IdleConnection> connections;
+	{
+		lock_guard<mutex> l(lock);
+		connections = std::move(idle_connections);
+		idle_connections.clear();
+	}
+	// the connections are closed outside of the lock
+}
+
+void MySQLConnectionPool::CloseExpiredConnections(std::chrono::steady_clock::time_point now) {
+	// connections are ordered by the time they were released - so the oldest connections are at the front
+	idx_t expired_count = 0;
+	while (idle_connections.size() - expired_count > config.min_size) {
+		auto &idle = idle_connections[expired_count];
+		auto idle_seconds = std::chrono::duration_cast<std::chrono::seconds>(now - idle.idle_since).count();
+		if (idle_seconds < int64_t(config.idle_timeout)) {
+			break;
+		}
+		expired_count++;
+	}
+	if (expired_count > 0) {
+		idle_connections.erase(idle_connections.begin(), idle_connections.begin() + int64_t(expired_count));
+	}
+}
+
+void OwnedMySQLConnection::CancelQuery() {
+	auto connection_pool = pool.lock();
+	if (!connection_pool || !connection) {
+		return;
+	}
+	try {
+		auto con = connection_pool->Acquire();
+		con.Execute("KILL QUERY " + to_string(mysql_thread_id(connection)));
+		connection_pool->Release(std::move(con));
+	} catch (std::exception &) {
+		// the query then runs to completion - its remaining rows are discarded when the result is freed
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,244 @@
+#include "mysql_decoder.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/decimal.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Integers
+//===--------------------------------------------------------------------===//
+template <class T>
+static bool TryParseInteger(const char *data, idx_t size, T &result) {
+	idx_t pos = 0;
+	bool negative = false;
+	if (pos < size && data[pos] == '-') {
+		negative = true;
+		pos++;
+	}
+	if (pos >= size || size - pos > 18) {
+		// empty or (potentially) too large to accumulate in an int64 - use the generic cast
+		return TryCast::Operation<string_t, T>(string_t(data, size), result, false);
+	}
+	uint64_t value = 0;
+	for (; pos < size; pos++) {
+		auto c = data[pos];
+		if (c < '0' || c > '9') {
+			return TryCast::Operation<string_t, T>(string_t(data, size), result, false);
+		}
+		value = value * 10 + uint64_t(c - '0');
+	}
+	if (negative) {
+		auto signed_value = -int64_t(value);
+		if (signed_value < int64_t(NumericLimits<T>::Minimum())) {
+			return false;
+		}
+		result = T(signed_value);
+	} else {
+		if (value > uint64_t(NumericLimits<T>::Maximum())) {
+			return false;
+		}
+		result = T(value);
+	}
+	return true;
+}
+
+template <class T>
+static void DecodeInteger(const string_t &input, Vector &result, idx_t row) {
+	if (!TryParseInteger<T>(input.GetData(), input.GetSize(), FlatVector::GetData<T>(result)[row])) {
+		FlatVector::SetNull(result, row, true);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Floating point / decimals
+//===--------------------------------------------------------------------===//
+//! Decodes values that have no fast path through the cast from VARCHAR - directly into the result vector
+template <class T>
+static void DecodeCast(const string_t &input, Vector &result, idx_t row) {
+	if (!TryCast::Operation<string_t, T>(input, FlatVector::GetData<T>(result)[row], false)) {
+		FlatVector::SetNull(result, row, true);
+	}
+}
+
+template <class T>
+static void DecodeDecimal(const string_t &input, Vector &result, idx_t row) {
+	auto scale = DecimalType::GetScale(result.GetType());
+	if (!MySQLDecoder::TryParseDecimal<T>(input.GetData(), input.GetSize(), scale,
+	                                      FlatVector::GetData<T>(result)[row])) {
+		FlatVector::SetNull(result, row, true);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Date / time
+//===--------------------------------------------------------------------===//
+static bool TryParseDigits(const char *data, idx_t count, int32_t &result) {
+	result = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (data[i] < '0' || data[i] > '9') {
+			return false;
+		}
+		result = result * 10 + (data[i] - '0');
+	}
+	return true;
+}
+
+//! Parses a date in MySQL's fixed YYYY-MM-DD format
+static bool TryParseDate(const char *data, idx_t size, date_t &result) {
+	int32_t year, month, day;
+	if (size < 10 || data[4] != '-' || data[7] != '-') {
+		return false;
+	}
+	if (!TryParseDigits(data, 4, year) || !TryParseDigits(data + 5, 2, month) || !TryParseDigits(data + 8, 2, day)) {
+		return false;
+	}
+	// MySQL allows "zero" dates (e.g. 0000-00-00) which we cannot represent
+	if (!Date::IsValid(year, month, day)) {
+		return false;
+	}
+	result = Date::FromDate(year, month, day);
+	return true;
+}
+
+//! Parses a timestamp in MySQL's fixed YYYY-MM-DD HH:MM:SS[.ffffff] format
+static bool TryParseTimestamp(const char *data, idx_t size, timestamp_t &result) {
+	date_t date;
+	if (!TryParseDate(data, size, date)) {
+		return false;
+	}
+	if (size == 10) {
+		result = Timestamp::FromDatetime(date, dtime_t(0));
+		return true;
+	}
+	int32_t hour, minute, second;
+	if (size < 19 || data[10] != ' ' || data[13] != ':' || data[16] != ':') {
+		return false;
+	}
+	if (!TryParseDigits(data + 11, 2, hour) || !TryParseDigits(data + 14, 2, minute) ||
+	    !TryParseDigits(data + 17, 2, second)) {
+		return false;
+	}
+	int32_t micros = 0;
+	if (size > 19) {
+		idx_t fraction_digits = size - 20;
+		if (data[19] != '.' || fraction_digits == 0 || fraction_digits > 6) {
+			return false;
+		}
+		if (!TryParseDigits(data + 20, fraction_digits, micros)) {
+			return false;
+		}
+		for (; fraction_digits < 6; fraction_digits++) {
+			micros *= 10;
+		}
+	}
+	if (!Time::IsValidTime(hour, minute, second, micros)) {
+		return false;
+	}
+	result = Timestamp::FromDatetime(date, Time::FromTime(hour, minute, second, micros));
+	return true;
+}
+
+template <class T, bool (*FAST_PARSE)(const char *, idx_t, T &)>
+static void DecodeTemporal(const string_t &input, Vector &result, idx_t row) {
+	auto &target = FlatVector::GetData<T>(result)[row];
+	if (FAST_PARSE(input.GetData(), input.GetSize(), target)) {
+		return;
+	}
+	// not in the canonical format - fall back to the generic cast
+	if (!TryCast::Operation<string_t, T>(input, target, false)) {
+		FlatVector::SetNull(result, row, true);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Other types
+//===--------------------------------------------------------------------===//
+static void DecodeBoolean(const string_t &input, Vector &result, idx_t row) {
+	auto str_data = input.GetData();
+	auto str_size = input.GetSize();
+	if (str_size == 0) {
+		throw BinderException(
+		    "Failed to cast MySQL boolean - expected 1 byte element but got element of size %d\n* SET "
+		    "mysql_tinyint1_as_boolean=false to disable loading TINYINT(1) columns as booleans\n* SET "
+		    "mysql_bit1_as_boolean=false to disable loading BIT(1) columns as booleans",
+		    str_size);
+	}
+	// booleans are EITHER binary "1" or "0" (BIT(1))
+	// OR a number
+	// in both cases we can figure out what value it is from the first character:
+	// \0 -> zero byte, false
+	// - -> negative number, false
+	// 0 -> zero number, false
+	FlatVector::GetData<bool>(result)[row] = !(*str_data == '\0' || *str_data == '0' || *str_data == '-');
+}
+
+static void DecodeString(const string_t &input, Vector &result, idx_t row) {
+	// blobs are sent over the wire as-is
+	FlatVector::GetData<string_t>(result)[row] = StringVector::AddStringOrBlob(result, input);
+}
+
+static void DecodeStringReference(const string_t &input, Vector &result, idx_t row) {
+	// the string points into the fetched row - which is kept alive by the result vector
+	FlatVector::GetData<string_t>(result)[row] = input;
+}
+
+mysql_decode_function_t MySQLDecoder::GetDecodeFunction(const LogicalType &type, bool reference_strings) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		return DecodeBoolean;
+	case LogicalTypeId::TINYINT:
+		return DecodeInteger<int8_t>;
+	case LogicalTypeId::SMALLINT:
+		return DecodeInteger<int16_t>;
+	case LogicalTypeId::INTEGER:
+		return DecodeInteger<int32_t>;
+	case LogicalTypeId::BIGINT:
+		return DecodeInteger<int64_t>;
+	case LogicalTypeId::UTINYINT:
+		return DecodeInteger<uint8_t>;
+	case LogicalTypeId::USMALLINT:
+		return DecodeInteger<uint16_t>;
+	case LogicalTypeId::UINTEGER:
+		return DecodeInteger<uint32_t>;
+	case LogicalTypeId::UBIGINT:
+		return DecodeInteger<uint64_t>;
+	case LogicalTypeId::HUGEINT:
+		return DecodeCast<hugeint_t>;
+	case LogicalTypeId::UHUGEINT:
+		return DecodeCast<uhugeint_t>;
+	case LogicalTypeId::FLOAT:
+		return DecodeCast<float>;
+	case LogicalTypeId::DOUBLE:
+		return DecodeCast<double>;
+	case LogicalTypeId::DECIMAL:
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			return DecodeDecimal<int16_t>;
+		case PhysicalType::INT32:
+			return DecodeDecimal<int32_t>;
+		case PhysicalType::INT64:
+			return DecodeDecimal<int64_t>;
+		case PhysicalType::INT128:
+			return DecodeDecimal<hugeint_t>;
+		default:
+			throw InternalException("Unsupported decimal storage type");
+		}
+	case LogicalTypeId::DATE:
+		return DecodeTemporal<date_t, TryParseDate>;
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return DecodeTemporal<timestamp_t, TryParseTimestamp>;
+	case LogicalTypeId::TIME:
+		return DecodeCast<dtime_t>;
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return reference_strings ? DecodeStringReference : DecodeString;
+	default:
+		throw NotImplementedException("Unsupported type \"%s\" for decoding MySQL values", type.ToString());
+	}
+}
+
+} // namespace duckdb
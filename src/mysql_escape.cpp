@@ -0,0 +1,180 @@
+#include "mysql_escape.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#define MYSQL_ESCAPE_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MYSQL_ESCAPE_NEON
+#endif
+
+namespace duckdb {
+
+static constexpr const idx_t BLOCK_SIZE = 16;
+static constexpr const char *HEX_DIGITS = "0123456789ABCDEF";
+
+static inline bool IsLoadDataSpecial(char c) {
+	return c == '\\' || c == '\0' || c == '\n' || c == '\r' || c == '\t';
+}
+
+#if defined(MYSQL_ESCAPE_SSE2)
+static inline int QuotedMask(const char *data, __m128i quote, __m128i backslash) {
+	auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+	auto matches = _mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash));
+	return _mm_movemask_epi8(matches);
+}
+
+static inline int LoadDataMask(const char *data) {
+	auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+	auto matches = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\\')), _mm_cmpeq_epi8(block, _mm_setzero_si128()));
+	matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8('\n')));
+	matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8('\r')));
+	matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')));
+	return _mm_movemask_epi8(matches);
+}
+
+static inline idx_t FirstSetBit(int mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	unsigned long index;
+	_BitScanForward(&index, static_cast<unsigned long>(mask));
+	return index;
+#else
+	return static_cast<idx_t>(__builtin_ctz(static_cast<unsigned int>(mask)));
+#endif
+}
+#endif
+
+idx_t MySQLEscape::FindQuoted(const char *data, idx_t size, char quote) {
+	idx_t i = 0;
+#if defined(MYSQL_ESCAPE_SSE2)
+	auto quote_block = _mm_set1_epi8(quote);
+	auto backslash_block = _mm_set1_epi8('\\');
+	for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+		auto mask = QuotedMask(data + i, quote_block, backslash_block);
+		if (mask != 0) {
+			return i + FirstSetBit(mask);
+		}
+	}
+#elif defined(MYSQL_ESCAPE_NEON)
+	auto quote_block = vdupq_n_u8(static_cast<uint8_t>(quote));
+	auto backslash_block = vdupq_n_u8('\\');
+	for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+		auto block = vld1q_u8(reinterpret_cast<const uint8_t *>(data + i));
+		auto matches = vorrq_u8(vceqq_u8(block, quote_block), vceqq_u8(block, backslash_block));
+		if (vmaxvq_u8(matches) != 0) {
+			// the matching byte is found by the scalar loop below
+			break;
+		}
+	}
+#endif
+	for (; i < size; i++) {
+		if (data[i] == quote || data[i] == '\\') {
+			return i;
+		}
+	}
+	return size;
+}
+
+idx_t MySQLEscape::FindLoadData(const char *data, idx_t size) {
+	idx_t i = 0;
+#if defined(MYSQL_ESCAPE_SSE2)
+	for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+		auto mask = LoadDataMask(data + i);
+		if (mask != 0) {
+			return i + FirstSetBit(mask);
+		}
+	}
+#elif defined(MYSQL_ESCAPE_NEON)
+	for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+		auto block = vld1q_u8(reinterpret_cast<const uint8_t *>(data + i));
+		auto matches = vorrq_u8(vceqq_u8(block, vdupq_n_u8('\\')), vceqzq_u8(block));
+		matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8('\n')));
+		matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8('\r')));
+		matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8('\t')));
+		if (vmaxvq_u8(matches) != 0) {
+			break;
+		}
+	}
+#endif
+	for (; i < size; i++) {
+		if (IsLoadDataSpecial(data[i])) {
+			return i;
+		}
+	}
+	return size;
+}
+
+idx_t MySQLEscape::EscapeQuoted(const char *data, idx_t size, char quote, char *result) {
+	idx_t position = 0;
+	idx_t i = 0;
+	while (i < size) {
+		auto next = i + FindQuoted(data + i, size - i, quote);
+		// copy the run of bytes that do not need to be escaped
+		memcpy(result + position, data + i, next - i);
+		position += next - i;
+		if (next == size) {
+			break;
+		}
+		result[position++] = '\\';
+		result[position++] = data[next];
+		i = next + 1;
+	}
+	return position;
+}
+
+idx_t MySQLEscape::EscapeLoadData(const char *data, idx_t size, char *result) {
+	idx_t position = 0;
+	idx_t i = 0;
+	while (i < size) {
+		auto next = i + FindLoadData(data + i, size - i);
+		memcpy(result + position, data + i, next - i);
+		position += next - i;
+		if (next == size) {
+			break;
+		}
+		result[position++] = '\\';
+		result[position++] = GetLoadDataEscape(data[next]);
+		i = next + 1;
+	}
+	return position;
+}
+
+void MySQLEscape::WriteHex(const_data_ptr_t data, idx_t size, char *result) {
+	idx_t i = 0;
+#if defined(MYSQL_ESCAPE_SSE2)
+	auto low_mask = _mm_set1_epi8(0x0F);
+	auto nine = _mm_set1_epi8(9);
+	auto zero_char = _mm_set1_epi8('0');
+	// 'A' - '0' - 10: the distance between the digits and the letters
+	auto letter_offset = _mm_set1_epi8('A' - '0' - 10);
+	for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+		auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+		auto high = _mm_and_si128(_mm_srli_epi16(block, 4), low_mask);
+		auto low = _mm_and_si128(block, low_mask);
+		high = _mm_add_epi8(_mm_add_epi8(high, zero_char), _mm_and_si128(_mm_cmpgt_epi8(high, nine), letter_offset));
+		low = _mm_add_epi8(_mm_add_epi8(low, zero_char), _mm_and_si128(_mm_cmpgt_epi8(low, nine), letter_offset));
+		// the high digit of every byte comes first
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i * 2), _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i * 2 + BLOCK_SIZE), _mm_unpackhi_epi8(high, low));
+	}
+#elif defined(MYSQL_ESCAPE_NEON)
+	auto digits = vld1q_u8(reinterpret_cast<const uint8_t *>(HEX_DIGITS));
+	for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+		auto block = vld1q_u8(data + i);
+		uint8x16x2_t hex;
+		hex.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(block, 4));
+		hex.val[1] = vqtbl1q_u8(digits, vandq_u8(block, vdupq_n_u8(0x0F)));
+		// interleaves the high and low digits of every byte
+		vst2q_u8(reinterpret_cast<uint8_t *>(result + i * 2), hex);
+	}
+#endif
+	for (; i < size; i++) {
+		result[i * 2] = HEX_DIGITS[data[i] >> 4];
+		result[i * 2 + 1] = HEX_DIGITS[data[i] & 0x0F];
+	}
+}
+
+} // namespace duckdb
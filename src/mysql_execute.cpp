@@ -50,6 +50,8 @@ static void MySQLExecuteFunc(ClientContext &context, TableFunctionInput &data_p,
 		throw PermissionException("mysql_execute cannot be run in a read-only connection");
 	}
 	transaction.GetConnection().Execute(data.query);
+	// the statement can modify any table
+	transaction.InvalidateAllOnCompletion();
 	data.finished = true;
 }
 
@@ -56,6 +56,18 @@ unique_ptr<BaseSecret> CreateMySQLSecretFunction(ClientContext &, CreateSecretIn
 			result->secret_map["ssl_crlpath"] = named_param.second.ToString();
 		} else if (lower_name == "ssl_key") {
 			result->secret_map["ssl_key"] = named_param.second.ToString();
+		} else if (lower_name == "compression") {
+			result->secret_map["compression"] = named_param.second.ToString();
+		} else if (lower_name == "compression_algorithms") {
+			result->secret_map["compression_algorithms"] = named_param.second.ToString();
+		} else if (lower_name == "zstd_compression_level") {
+			result->secret_map["zstd_compression_level"] = named_param.second.ToString();
+		} else if (lower_name == "replicas") {
+			result->secret_map["replicas"] = named_param.second.ToString();
+		} else if (lower_name == "replica_policy") {
+			result->secret_map["replica_policy"] = named_param.second.ToString();
+		} else if (lower_name == "replica_max_lag") {
+			result->secret_map["replica_max_lag"] = named_param.second.ToString();
 		} else {
 			throw InternalException("Unknown named parameter passed to CreateMySQLSecretFunction: " + lower_name);
 		}
@@ -81,12 +93,17 @@ void SetMySQLSecretParameters(CreateSecretFunction &function) {
 	function.named_parameters["ssl_crl"] = LogicalType::VARCHAR;
 	function.named_parameters["ssl_crlpath"] = LogicalType::VARCHAR;
 	function.named_parameters["ssl_key"] = LogicalType::VARCHAR;
+	function.named_parameters["compression"] = LogicalType::VARCHAR;
+	function.named_parameters["compression_algorithms"] = LogicalType::VARCHAR;
+	function.named_parameters["zstd_compression_level"] = LogicalType::VARCHAR;
+	function.named_parameters["replicas"] = LogicalType::VARCHAR;
+	function.named_parameters["replica_policy"] = LogicalType::VARCHAR;
+	function.named_parameters["replica_max_lag"] = LogicalType::VARCHAR;
 }
 
 static void LoadInternal(DatabaseInstance &db) {
 	mysql_library_init(0, NULL, NULL);
-	MySQLClearCacheFunction clear_cache_func;
-	ExtensionUtil::RegisterFunction(db, clear_cache_func);
+	ExtensionUtil::RegisterFunction(db, MySQLClearCacheFunction::GetFunctionSet());
 
 	MySQLExecuteFunction execute_function;
 	ExtensionUtil::RegisterFunction(db, execute_function);
@@ -94,6 +111,27 @@ static void LoadInternal(DatabaseInstance &db) {
 	MySQLQueryFunction query_function;
 	ExtensionUtil::RegisterFunction(db, query_function);
 
+	MySQLScanIncrementalFunction scan_incremental_function;
+	ExtensionUtil::RegisterFunction(db, scan_incremental_function);
+
+	MySQLBinlogScanFunction binlog_scan_function;
+	ExtensionUtil::RegisterFunction(db, binlog_scan_function);
+
+	MySQLScanStatsFunction scan_stats_function;
+	ExtensionUtil::RegisterFunction(db, scan_stats_function);
+
+	MySQLWatermarksFunction watermarks_function;
+	ExtensionUtil::RegisterFunction(db, watermarks_function);
+
+	MySQLCacheTableFunction cache_table_function;
+	ExtensionUtil::RegisterFunction(db, cache_table_function);
+
+	MySQLUncacheTableFunction uncache_table_function;
+	ExtensionUtil::RegisterFunction(db, uncache_table_function);
+
+	MySQLCopyFunction copy_function;
+	ExtensionUtil::RegisterFunction(db, copy_function);
+
 	SecretType secret_type;
 	secret_type.name = "mysql";
 	secret_type.deserializer = KeyValueSecret::Deserialize<KeyValueSecret>;
@@ -117,6 +155,121 @@ static void LoadInternal(DatabaseInstance &db) {
 	                          LogicalType::BOOLEAN, Value::BOOLEAN(true), MySQLClearCacheFunction::ClearCacheOnSetting);
 	config.AddExtensionOption("mysql_bit1_as_boolean", "Whether or not to convert BIT(1) columns to BOOLEAN",
 	                          LogicalType::BOOLEAN, Value::BOOLEAN(true), MySQLClearCacheFunction::ClearCacheOnSetting);
+	config.AddExtensionOption("mysql_streaming_results",
+	                          "Whether or not to stream results from MySQL over a dedicated connection instead of "
+	                          "buffering the entire result in memory",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_pipelined_scan",
+	                          "Whether or not streamed results are fetched on a background thread while the previously "
+	                          "fetched rows are decoded",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_zero_copy_strings",
+	                          "Whether or not scanned VARCHAR and BLOB values reference the fetched rows instead of "
+	                          "being copied",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_binary_protocol",
+	                          "Whether or not to read table scans as prepared statements over the binary protocol, "
+	                          "instead of parsing values from text",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_prepared_statement_cache_size",
+	                          "The number of prepared statements kept per connection for re-use by scans that only "
+	                          "differ in their filter constants, or 0 to disable the statement cache",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("mysql_parallel_scan",
+	                          "Whether or not to scan tables with an integer primary key in parallel over multiple "
+	                          "connections",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_parallel_scan_partition_size",
+	                          "The minimum number of primary key values covered by a single partition of a parallel scan",
+	                          LogicalType::UBIGINT, Value::UBIGINT(1000000));
+	config.AddExtensionOption("mysql_parallel_scan_consistent_snapshot",
+	                          "Whether or not all connections of a parallel scan read from one consistent snapshot",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_partition_scan",
+	                          "Whether or not scans of partitioned tables skip the partitions that cannot hold rows "
+	                          "matching the filters, and parallel scans split partitioned tables by partition",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("mysql_use_load_data",
+	                          "Whether or not to insert data using LOAD DATA LOCAL INFILE instead of INSERT statements",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_insert_batch_bytes",
+	                          "The size in bytes of the batches of rows sent to MySQL when inserting data, or 0 to size "
+	                          "batches adaptively based on @@max_allowed_packet and the observed latency",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("mysql_parallel_insert",
+	                          "Whether or not to insert data in parallel, with each thread writing over its own connection",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_parallel_insert_staging",
+	                          "Whether or not parallel inserts write into a staging table that is moved into the target "
+	                          "table within the transaction, making parallel inserts atomic",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_table_statistics",
+	                          "Whether or not to use the row counts and distinct counts estimated by MySQL when planning "
+	                          "queries",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("mysql_explain_cardinality",
+	                          "Whether or not to estimate the number of rows that match the filters of a scan by asking "
+	                          "MySQL's optimizer (through EXPLAIN) when planning queries",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_sample_pushdown",
+	                          "Whether or not to push down samples (USING SAMPLE / TABLESAMPLE) into MySQL, so that only "
+	                          "the sampled rows are transferred",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("mysql_ordered_scan",
+	                          "Whether or not an ORDER BY the (numeric) primary key of a MySQL table is answered by reading "
+	                          "the table in primary key order, instead of sorting the rows in DuckDB",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("mysql_aggregate_pushdown",
+	                          "Whether or not to push down GROUP BY and simple aggregates (COUNT, SUM, MIN, MAX) into "
+	                          "MySQL",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_join_pushdown",
+	                          "Whether or not to push down inner joins between tables of the same attached database into "
+	                          "MySQL",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_schema_cache_path",
+	                          "Directory in which the schema information of attached databases is cached across "
+	                          "processes (disabled if empty)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("mysql_lazy_schema_loading",
+	                          "Whether or not to load the schema information of a single table when it is used, "
+	                          "instead of loading all tables of the schema",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_batched_modifications",
+	                          "Whether or not DELETE and UPDATE statements modify the rows identified by DuckDB in "
+	                          "batches by primary key, committing every batch separately in auto-commit mode",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("mysql_modification_batch_size",
+	                          "The number of rows modified per statement by batched DELETE and UPDATE statements",
+	                          LogicalType::UBIGINT, Value::UBIGINT(1000));
+	config.AddExtensionOption("mysql_result_cache_ttl",
+	                          "The number of seconds for which the results of MySQL queries are cached, or 0 to disable "
+	                          "the result cache",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("mysql_result_cache_max_bytes",
+	                          "The maximum total size in bytes of the cached results per attached database",
+	                          LogicalType::UBIGINT, Value::UBIGINT(268435456));
+	config.AddExtensionOption("mysql_use_cached_tables",
+	                          "Whether or not scans of tables cached through mysql_cache_table read the local copy of the "
+	                          "table",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("mysql_cached_table_background_refresh",
+	                          "Whether or not copies of cached tables that are older than their refresh interval are "
+	                          "refreshed in the background, while queries keep reading the previous copy",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("mysql_connection_pool",
+	                          "Whether or not to keep idle connections open so they can be reused by later transactions",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("mysql_connection_pool_min_size",
+	                          "The number of idle connections per attached database that are kept open regardless of "
+	                          "mysql_connection_pool_idle_timeout",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("mysql_connection_pool_max_size",
+	                          "The maximum number of idle connections that are kept open per attached database",
+	                          LogicalType::UBIGINT, Value::UBIGINT(8));
+	config.AddExtensionOption("mysql_connection_pool_idle_timeout",
+	                          "The number of seconds after which idle pooled connections are closed",
+	                          LogicalType::UBIGINT, Value::UBIGINT(300));
 
 	OptimizerExtension mysql_optimizer;
 	mysql_optimizer.optimize_function = MySQLOptimizer::Optimize;
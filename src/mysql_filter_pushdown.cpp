@@ -1,18 +1,68 @@
 #include "mysql_filter_pushdown.hpp"
 #include "mysql_utils.hpp"
+#include "mysql_escape.hpp"
+#include "storage/mysql_table_entry.hpp"
 #include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 
 namespace duckdb {
 
-string MySQLFilterPushdown::CreateExpression(string &column_name, vector<unique_ptr<TableFilter>> &filters, string op) {
+string MySQLFilterPushdown::CreateExpression(string &column_name, vector<unique_ptr<TableFilter>> &filters, string op,
+                                             optional_ptr<vector<Value>> parameters) {
 	vector<string> filter_entries;
+	auto parameter_count = parameters ? parameters->size() : 0;
 	for (auto &filter : filters) {
-		filter_entries.push_back(TransformFilter(column_name, *filter));
+		auto filter_entry = TransformFilter(column_name, *filter, parameters);
+		if (filter_entry.empty()) {
+			// an optional filter that was skipped - this makes the entire OR optional
+			if (op == "OR") {
+				if (parameters) {
+					// drop the parameters of the entries that were already transformed
+					parameters->resize(parameter_count);
+				}
+				return string();
+			}
+			continue;
+		}
+		filter_entries.push_back(std::move(filter_entry));
+	}
+	if (filter_entries.empty()) {
+		return string();
 	}
 	return "(" + StringUtil::Join(filter_entries, " " + op + " ") + ")";
 }
 
+bool MySQLFilterPushdown::IsSupportedFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::IS_NULL:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::OPTIONAL_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND:
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_filter = filter.Cast<ConjunctionFilter>();
+		for (auto &child : conjunction_filter.child_filters) {
+			if (!IsSupportedFilter(*child)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
 string MySQLFilterPushdown::TransformComparison(ExpressionType type) {
 	switch (type) {
 	case ExpressionType::COMPARE_EQUAL:
@@ -32,17 +82,12 @@ string MySQLFilterPushdown::TransformComparison(ExpressionType type) {
 	}
 }
 
-
 static string TransformBlobToMySQL(const string &val) {
-	char const HEX_DIGITS[] = "0123456789ABCDEF";
-
-	string result = "x'";
-	for(idx_t i = 0; i < val.size(); i++) {
-		uint8_t byte_val = static_cast<uint8_t>(val[i]);
-		result += HEX_DIGITS[(byte_val >> 4) & 0xf];
-		result += HEX_DIGITS[byte_val & 0xf];
-	}
-	result += "'";
+	string result(val.size() * 2 + 3, '\0');
+	result[0] = 'x';
+	result[1] = '\'';
+	MySQLEscape::WriteHex(const_data_ptr_cast(val.data()), val.size(), &result[2]);
+	result.back() = '\'';
 	return result;
 }
 
@@ -59,7 +104,33 @@ string MySQLFilterPushdown::TransformConstant(const Value &val) {
 	return val.DefaultCastAs(LogicalType::VARCHAR).ToSQLString();
 }
 
-string MySQLFilterPushdown::TransformFilter(string &column_name, TableFilter &filter) {
+string MySQLFilterPushdown::TransformParameter(const Value &val, optional_ptr<vector<Value>> parameters) {
+	if (!parameters) {
+		return TransformConstant(val);
+	}
+	parameters->push_back(val);
+	return "?";
+}
+
+string MySQLFilterPushdown::TransformWatermark(const string &column_name, const LogicalType &type,
+                                              const string &low_watermark, const string &high_watermark) {
+	// numbers are compared as numbers - quoting them would compare them as doubles
+	auto write_watermark = [&](const string &watermark) {
+		return type.IsNumeric() ? watermark : MySQLUtils::WriteLiteral(watermark);
+	};
+	auto column = MySQLUtils::WriteIdentifier(column_name);
+	vector<string> conditions;
+	if (!low_watermark.empty()) {
+		conditions.push_back(column + " > " + write_watermark(low_watermark));
+	}
+	if (!high_watermark.empty()) {
+		conditions.push_back(column + " <= " + write_watermark(high_watermark));
+	}
+	return StringUtil::Join(conditions, " AND ");
+}
+
+string MySQLFilterPushdown::TransformFilter(string &column_name, TableFilter &filter,
+                                            optional_ptr<vector<Value>> parameters) {
 	switch (filter.filter_type) {
 	case TableFilterType::IS_NULL:
 		return column_name + " IS NULL";
@@ -67,21 +138,25 @@ string MySQLFilterPushdown::TransformFilter(string &column_name, TableFilter &fi
 		return column_name + " IS NOT NULL";
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
-		return CreateExpression(column_name, conjunction_filter.child_filters, "AND");
+		return CreateExpression(column_name, conjunction_filter.child_filters, "AND", parameters);
 	}
 	case TableFilterType::CONJUNCTION_OR: {
 		auto &conjunction_filter = filter.Cast<ConjunctionOrFilter>();
-		return CreateExpression(column_name, conjunction_filter.child_filters, "OR");
+		return CreateExpression(column_name, conjunction_filter.child_filters, "OR", parameters);
 	}
 	case TableFilterType::CONSTANT_COMPARISON: {
 		auto &constant_filter = filter.Cast<ConstantFilter>();
-		auto constant_string = TransformConstant(constant_filter.constant);
+		auto constant_string = TransformParameter(constant_filter.constant, parameters);
 		auto operator_string = TransformComparison(constant_filter.comparison_type);
 		return StringUtil::Format("%s %s %s", column_name, operator_string, constant_string);
 	}
 	case TableFilterType::OPTIONAL_FILTER: {
+		// optional filters (e.g. dynamic filters created by joins) only have to be applied if possible
 		auto &optional_filter = filter.Cast<OptionalFilter>();
-		return TransformFilter(column_name, *optional_filter.child_filter);
+		if (!IsSupportedFilter(*optional_filter.child_filter)) {
+			return string();
+		}
+		return TransformFilter(column_name, *optional_filter.child_filter, parameters);
 	}
 	case TableFilterType::IN_FILTER: {
 		auto &in_filter = filter.Cast<InFilter>();
@@ -90,7 +165,7 @@ string MySQLFilterPushdown::TransformFilter(string &column_name, TableFilter &fi
 			if (!in_list.empty()) {
 				in_list += ", ";
 			}
-			in_list += TransformConstant(val);
+			in_list += TransformParameter(val, parameters);
 		}
 		return column_name + " IN (" + in_list + ")";
 		}
@@ -100,21 +175,487 @@ string MySQLFilterPushdown::TransformFilter(string &column_name, TableFilter &fi
 }
 
 string MySQLFilterPushdown::TransformFilters(const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
-                                             const vector<string> &names) {
+                                             const vector<string> &names, optional_ptr<vector<Value>> parameters) {
 	if (!filters || filters->filters.empty()) {
 		// no filters
 		return string();
 	}
 	string result;
 	for (auto &entry : filters->filters) {
+		auto column_name = MySQLUtils::WriteIdentifier(names[column_ids[entry.first]]);
+		auto &filter = *entry.second;
+		auto filter_string = TransformFilter(column_name, filter, parameters);
+		if (filter_string.empty()) {
+			// skipped optional filter
+			continue;
+		}
 		if (!result.empty()) {
 			result += " AND ";
 		}
-		auto column_name = MySQLUtils::WriteIdentifier(names[column_ids[entry.first]]);
-		auto &filter = *entry.second;
-		result += TransformFilter(column_name, filter);
+		result += filter_string;
 	}
 	return result;
 }
 
+//===--------------------------------------------------------------------===//
+// Partition Pruning
+//===--------------------------------------------------------------------===//
+static bool ComparisonMayMatch(ExpressionType comparison, const Value &value, const Value &constant) {
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		return value == constant;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return value < constant;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return value <= constant;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return value > constant;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return value >= constant;
+	default:
+		return true;
+	}
+}
+
+//! Whether or not any value of a partition can satisfy the comparison with the constant
+static bool PartitionMayMatch(ExpressionType comparison, const Value &constant, MySQLPartitionMethod method,
+                              const MySQLPartitionInfo &partition) {
+	if (method == MySQLPartitionMethod::LIST) {
+		for (auto &value : partition.values) {
+			if (value.type() != constant.type() || ComparisonMayMatch(comparison, value, constant)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	// the values of a RANGE partition are lower_bound <= value < upper_bound
+	auto &lower = partition.lower_bound;
+	auto &upper = partition.upper_bound;
+	if ((!lower.IsNull() && lower.type() != constant.type()) || (!upper.IsNull() && upper.type() != constant.type())) {
+		return true;
+	}
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		return (lower.IsNull() || lower <= constant) && (upper.IsNull() || constant < upper);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return lower.IsNull() || lower < constant;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return lower.IsNull() || lower <= constant;
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return upper.IsNull() || constant < upper;
+	default:
+		return true;
+	}
+}
+
+//! Whether or not a partition can hold rows matching the filter - this is conservative, any filter that is not
+//! understood may match
+static bool PartitionMayMatch(const TableFilter &filter, MySQLPartitionMethod method,
+                              const MySQLPartitionInfo &partition) {
+	switch (filter.filter_type) {
+	case TableFilterType::IS_NULL:
+		return partition.contains_null;
+	case TableFilterType::IS_NOT_NULL:
+		return method == MySQLPartitionMethod::RANGE || !partition.values.empty();
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return PartitionMayMatch(constant_filter.comparison_type, constant_filter.constant, method, partition);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &val : in_filter.values) {
+			if (PartitionMayMatch(ExpressionType::COMPARE_EQUAL, val, method, partition)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child : conjunction_filter.child_filters) {
+			if (!PartitionMayMatch(*child, method, partition)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child : conjunction_filter.child_filters) {
+			if (PartitionMayMatch(*child, method, partition)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::OPTIONAL_FILTER: {
+		// optional filters are pushed into MySQL as well - so they can prune partitions like any other filter
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		return PartitionMayMatch(*optional_filter.child_filter, method, partition);
+	}
+	default:
+		return true;
+	}
+}
+
+vector<idx_t> MySQLFilterPushdown::PrunePartitions(const vector<column_t> &column_ids,
+                                                   optional_ptr<TableFilterSet> filters, const vector<string> &names,
+                                                   const MySQLTablePartitions &partitions) {
+	vector<idx_t> result;
+	for (idx_t i = 0; i < partitions.partitions.size(); i++) {
+		result.push_back(i);
+	}
+	if (!filters || partitions.column_name.empty()) {
+		return result;
+	}
+	for (auto &entry : filters->filters) {
+		auto column_id = column_ids[entry.first];
+		if (column_id >= names.size() || !StringUtil::CIEquals(names[column_id], partitions.column_name)) {
+			continue;
+		}
+		vector<idx_t> remaining;
+		for (auto partition_idx : result) {
+			if (PartitionMayMatch(*entry.second, partitions.method, partitions.partitions[partition_idx])) {
+				remaining.push_back(partition_idx);
+			}
+		}
+		result = std::move(remaining);
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Expression Pushdown
+//===--------------------------------------------------------------------===//
+enum class MySQLValueKind { NUMERIC, TEMPORAL, STRING, BLOB, UNSUPPORTED };
+
+static MySQLValueKind GetValueKind(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DOUBLE:
+		return MySQLValueKind::NUMERIC;
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+		// "zero" dates are read as NULL by DuckDB, but compare as dates before all other dates in MySQL
+		return MySQLValueKind::TEMPORAL;
+	case LogicalTypeId::VARCHAR:
+		// strings are compared according to the collation of the column (e.g. case-insensitively)
+		return MySQLValueKind::STRING;
+	case LogicalTypeId::BLOB:
+		return MySQLValueKind::BLOB;
+	default:
+		// booleans can be any number in MySQL, FLOAT is compared as DOUBLE, etc
+		return MySQLValueKind::UNSUPPORTED;
+	}
+}
+
+static bool IsIntegerType(const LogicalType &type) {
+	return type.IsIntegral() && type.id() != LogicalTypeId::HUGEINT && type.id() != LogicalTypeId::UHUGEINT;
+}
+
+static bool TransformLikePattern(const Value &constant, const string &prefix, const string &suffix, string &result) {
+	if (constant.IsNull() || constant.type().id() != LogicalTypeId::VARCHAR) {
+		return false;
+	}
+	auto &str = StringValue::Get(constant);
+	for (auto c : str) {
+		// backslashes are escape characters in MySQL, and "_" matches a character instead of a byte
+		if (c == '\\' || c == '_' || ((c == '%') && (!prefix.empty() || !suffix.empty()))) {
+			return false;
+		}
+	}
+	result = Value(prefix + str + suffix).ToSQLString();
+	return true;
+}
+
+bool MySQLFilterPushdown::TransformComparisonExpression(const Expression &expr, idx_t table_index,
+                                                        const vector<string> &column_names, string &result,
+                                                        bool &exact) {
+	auto &comparison = expr.Cast<BoundComparisonExpression>();
+	auto kind = GetValueKind(comparison.left->return_type);
+	if (kind != GetValueKind(comparison.right->return_type)) {
+		return false;
+	}
+	string op;
+	switch (comparison.type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_NOTEQUAL:
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		op = TransformComparison(comparison.type);
+		break;
+	case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+		op = "<=>";
+		break;
+	default:
+		return false;
+	}
+	switch (kind) {
+	case MySQLValueKind::NUMERIC:
+	case MySQLValueKind::BLOB:
+		break;
+	case MySQLValueKind::TEMPORAL:
+		// comparisons against "zero" dates can be true in MySQL, but never are in DuckDB
+		if (comparison.type == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			return false;
+		}
+		exact = false;
+		break;
+	case MySQLValueKind::STRING:
+		// strings that are equal are also equal in every collation - but the order depends on the collation
+		if (comparison.type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		exact = false;
+		break;
+	default:
+		return false;
+	}
+	string left, right;
+	if (!TransformExpression(*comparison.left, table_index, column_names, left, exact) ||
+	    !TransformExpression(*comparison.right, table_index, column_names, right, exact)) {
+		return false;
+	}
+	result = "(" + left + " " + op + " " + right + ")";
+	return true;
+}
+
+bool MySQLFilterPushdown::TransformFunctionExpression(const Expression &expr, idx_t table_index,
+                                                      const vector<string> &column_names, string &result,
+                                                      bool &exact) {
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	auto &name = func.function.name;
+	if (func.children.size() == 2 && (name == "+" || name == "-" || name == "*")) {
+		if (GetValueKind(func.return_type) != MySQLValueKind::NUMERIC ||
+		    GetValueKind(func.children[0]->return_type) != MySQLValueKind::NUMERIC ||
+		    GetValueKind(func.children[1]->return_type) != MySQLValueKind::NUMERIC) {
+			return false;
+		}
+		string left, right;
+		if (!TransformExpression(*func.children[0], table_index, column_names, left, exact) ||
+		    !TransformExpression(*func.children[1], table_index, column_names, right, exact)) {
+			return false;
+		}
+		result = "(" + left + " " + name + " " + right + ")";
+		return true;
+	}
+	if (func.children.size() == 1 && (name == "year" || name == "month" || name == "day")) {
+		if (GetValueKind(func.children[0]->return_type) != MySQLValueKind::TEMPORAL) {
+			return false;
+		}
+		string child;
+		if (!TransformExpression(*func.children[0], table_index, column_names, child, exact)) {
+			return false;
+		}
+		// the date parts of "zero" dates are 0 in MySQL
+		exact = false;
+		result = (name == "day" ? string("DAYOFMONTH") : StringUtil::Upper(name)) + "(" + child + ")";
+		return true;
+	}
+	if (func.children.size() != 2 || func.children[1]->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT ||
+	    GetValueKind(func.children[0]->return_type) != MySQLValueKind::STRING) {
+		return false;
+	}
+	// string matching - LIKE 'abc%' is rewritten into prefix(str, 'abc') by DuckDB, etc
+	auto &constant = func.children[1]->Cast<BoundConstantExpression>().value;
+	string pattern;
+	if (name == "~~") {
+		if (!TransformLikePattern(constant, string(), string(), pattern)) {
+			return false;
+		}
+	} else if (name == "prefix") {
+		if (!TransformLikePattern(constant, string(), "%", pattern)) {
+			return false;
+		}
+	} else if (name == "suffix") {
+		if (!TransformLikePattern(constant, "%", string(), pattern)) {
+			return false;
+		}
+	} else if (name == "contains") {
+		if (!TransformLikePattern(constant, "%", "%", pattern)) {
+			return false;
+		}
+	} else {
+		return false;
+	}
+	string input;
+	if (!TransformExpression(*func.children[0], table_index, column_names, input, exact)) {
+		return false;
+	}
+	// LIKE is case-insensitive for most collations in MySQL
+	exact = false;
+	result = "(" + input + " LIKE " + pattern + ")";
+	return true;
+}
+
+bool MySQLFilterPushdown::TransformExpression(const Expression &expr, idx_t table_index,
+                                              const vector<string> &column_names, string &result, bool &exact) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COLUMN_REF: {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (colref.depth > 0 || colref.binding.table_index != table_index ||
+		    colref.binding.column_index >= column_names.size() || column_names[colref.binding.column_index].empty()) {
+			return false;
+		}
+		result = column_names[colref.binding.column_index];
+		return true;
+	}
+	case ExpressionClass::BOUND_CONSTANT: {
+		auto &value = expr.Cast<BoundConstantExpression>().value;
+		if (value.IsNull()) {
+			result = "NULL";
+			return true;
+		}
+		switch (GetValueKind(value.type())) {
+		case MySQLValueKind::NUMERIC:
+		case MySQLValueKind::TEMPORAL:
+		case MySQLValueKind::BLOB:
+			break;
+		case MySQLValueKind::STRING:
+			if (StringValue::Get(value).find('\\') != string::npos) {
+				// backslashes are escape characters in MySQL string literals
+				return false;
+			}
+			break;
+		default:
+			return false;
+		}
+		result = TransformConstant(value);
+		return true;
+	}
+	case ExpressionClass::BOUND_CAST: {
+		auto &cast = expr.Cast<BoundCastExpression>();
+		// only casts from integers to wider numeric types are transparent in MySQL
+		if (cast.try_cast || !IsIntegerType(cast.child->return_type) ||
+		    GetValueKind(cast.return_type) != MySQLValueKind::NUMERIC) {
+			return false;
+		}
+		if (IsIntegerType(cast.return_type)) {
+			auto source_size = GetTypeIdSize(cast.child->return_type.InternalType());
+			auto target_size = GetTypeIdSize(cast.return_type.InternalType());
+			auto source_unsigned = cast.child->return_type.IsUnsigned();
+			auto target_unsigned = cast.return_type.IsUnsigned();
+			if (target_size < source_size || (!source_unsigned && target_unsigned) ||
+			    (source_unsigned && !target_unsigned && target_size == source_size)) {
+				return false;
+			}
+		}
+		return TransformExpression(*cast.child, table_index, column_names, result, exact);
+	}
+	case ExpressionClass::BOUND_COMPARISON:
+		return TransformComparisonExpression(expr, table_index, column_names, result, exact);
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = expr.Cast<BoundConjunctionExpression>();
+		string op = expr.type == ExpressionType::CONJUNCTION_AND ? " AND " : " OR ";
+		vector<string> children;
+		for (auto &child : conjunction.children) {
+			string child_result;
+			if (!TransformExpression(*child, table_index, column_names, child_result, exact)) {
+				return false;
+			}
+			children.push_back(std::move(child_result));
+		}
+		result = "(" + StringUtil::Join(children, op) + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
+		auto &between = expr.Cast<BoundBetweenExpression>();
+		auto kind = GetValueKind(between.input->return_type);
+		if (kind == MySQLValueKind::TEMPORAL) {
+			exact = false;
+		} else if (kind != MySQLValueKind::NUMERIC && kind != MySQLValueKind::BLOB) {
+			return false;
+		}
+		if (GetValueKind(between.lower->return_type) != kind || GetValueKind(between.upper->return_type) != kind) {
+			return false;
+		}
+		string input, lower, upper;
+		if (!TransformExpression(*between.input, table_index, column_names, input, exact) ||
+		    !TransformExpression(*between.lower, table_index, column_names, lower, exact) ||
+		    !TransformExpression(*between.upper, table_index, column_names, upper, exact)) {
+			return false;
+		}
+		result = "(" + input + (between.lower_inclusive ? " >= " : " > ") + lower + " AND " + input +
+		         (between.upper_inclusive ? " <= " : " < ") + upper + ")";
+		return true;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		auto &op = expr.Cast<BoundOperatorExpression>();
+		switch (expr.type) {
+		case ExpressionType::OPERATOR_NOT: {
+			// negating a condition that matches more rows would match fewer rows
+			bool child_exact = true;
+			string child;
+			if (!TransformExpression(*op.children[0], table_index, column_names, child, child_exact) || !child_exact) {
+				return false;
+			}
+			result = "(NOT " + child + ")";
+			return true;
+		}
+		case ExpressionType::OPERATOR_IS_NULL:
+		case ExpressionType::OPERATOR_IS_NOT_NULL: {
+			auto kind = GetValueKind(op.children[0]->return_type);
+			if (kind == MySQLValueKind::UNSUPPORTED) {
+				return false;
+			}
+			if (kind == MySQLValueKind::TEMPORAL) {
+				// "zero" dates are NULL in DuckDB, but not in MySQL
+				if (expr.type == ExpressionType::OPERATOR_IS_NULL) {
+					return false;
+				}
+				exact = false;
+			}
+			string child;
+			if (!TransformExpression(*op.children[0], table_index, column_names, child, exact)) {
+				return false;
+			}
+			result = "(" + child + (expr.type == ExpressionType::OPERATOR_IS_NULL ? " IS NULL)" : " IS NOT NULL)");
+			return true;
+		}
+		case ExpressionType::COMPARE_IN: {
+			auto kind = GetValueKind(op.children[0]->return_type);
+			if (kind == MySQLValueKind::UNSUPPORTED) {
+				return false;
+			}
+			if (kind == MySQLValueKind::STRING || kind == MySQLValueKind::TEMPORAL) {
+				exact = false;
+			}
+			vector<string> children;
+			for (auto &child : op.children) {
+				if (GetValueKind(child->return_type) != kind) {
+					return false;
+				}
+				string child_result;
+				if (!TransformExpression(*child, table_index, column_names, child_result, exact)) {
+					return false;
+				}
+				children.push_back(std::move(child_result));
+			}
+			auto input = std::move(children[0]);
+			children.erase(children.begin());
+			result = "(" + input + " IN (" + StringUtil::Join(children, ", ") + "))";
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+	case ExpressionClass::BOUND_FUNCTION:
+		return TransformFunctionExpression(expr, table_index, column_names, result, exact);
+	default:
+		return false;
+	}
+}
+
 } // namespace duckdb
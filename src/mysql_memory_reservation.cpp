@@ -0,0 +1,36 @@
+#include "mysql_memory_reservation.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+MySQLMemoryReservation::MySQLMemoryReservation(BufferManager &buffer_manager) : buffer_manager(&buffer_manager) {
+}
+
+MySQLMemoryReservation::~MySQLMemoryReservation() {
+	Resize(0);
+}
+
+MySQLMemoryReservation::MySQLMemoryReservation(MySQLMemoryReservation &&other) noexcept {
+	std::swap(buffer_manager, other.buffer_manager);
+	std::swap(size, other.size);
+}
+
+MySQLMemoryReservation &MySQLMemoryReservation::operator=(MySQLMemoryReservation &&other) noexcept {
+	std::swap(buffer_manager, other.buffer_manager);
+	std::swap(size, other.size);
+	return *this;
+}
+
+void MySQLMemoryReservation::Resize(idx_t new_size) {
+	if (!buffer_manager || new_size == size) {
+		return;
+	}
+	if (new_size > size) {
+		buffer_manager->ReserveMemory(new_size - size);
+	} else {
+		buffer_manager->FreeReservedMemory(size - new_size);
+	}
+	size = new_size;
+}
+
+} // namespace duckdb
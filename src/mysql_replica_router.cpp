@@ -0,0 +1,151 @@
+#include "mysql_replica_router.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+//! Returns the connection string of a replica - the options of the primary with the host (and port) replaced
+static string GetReplicaConnectionString(const string &connection_string, const string &replica) {
+	auto host = replica;
+	string port;
+	auto colon = replica.rfind(':');
+	if (colon != string::npos && replica.find(':') == colon) {
+		host = replica.substr(0, colon);
+		port = replica.substr(colon + 1);
+	}
+	if (StringUtil::CIEquals(host, "localhost")) {
+		// libmysql connects to localhost through the local socket - which ignores the port
+		host = "127.0.0.1";
+	}
+	// later options override earlier ones - the socket of the primary (if any) is cleared, as connections to
+	// localhost would otherwise reach the local server through it rather than the replica
+	auto result = connection_string + " host=" + host + " socket=\"\"";
+	if (!port.empty()) {
+		result += " port=" + port;
+	}
+	return result;
+}
+
+MySQLReplicaRouter::MySQLReplicaRouter(const string &connection_string, const MySQLConnectionParameters &parameters)
+    : policy(parameters.replica_policy == "least_loaded" ? MySQLReplicaPolicy::LEAST_LOADED
+                                                         : MySQLReplicaPolicy::ROUND_ROBIN),
+      max_lag(parameters.replica_max_lag) {
+	for (auto &replica_name : parameters.replicas) {
+		MySQLReplica replica;
+		replica.name = replica_name;
+		replica.connection_pool =
+		    make_shared_ptr<MySQLConnectionPool>(GetReplicaConnectionString(connection_string, replica_name));
+		replicas.push_back(std::move(replica));
+	}
+}
+
+//! Returns how many seconds the replica lags behind its source, or -1 if replication is not running
+static int64_t GetReplicationLag(ClientContext &context, MySQLConnection &connection) {
+	unique_ptr<MySQLResult> result;
+	try {
+		result = connection.Query("SHOW REPLICA STATUS", &context);
+	} catch (std::exception &) {
+		// SHOW REPLICA STATUS was introduced in MySQL 8.0.22
+		result = connection.Query("SHOW SLAVE STATUS", &context);
+	}
+	if (!result->Next()) {
+		// the server is not replicating from anywhere - so it cannot lag behind
+		return 0;
+	}
+	auto &fields = result->Fields();
+	for (idx_t c = 0; c < fields.size(); c++) {
+		if (fields[c].name == "Seconds_Behind_Source" || fields[c].name == "Seconds_Behind_Master") {
+			return result->IsNull(c) ? -1 : result->GetInt64(c);
+		}
+	}
+	return 0;
+}
+
+vector<idx_t> MySQLReplicaRouter::GetCandidates(std::chrono::steady_clock::time_point now) {
+	lock_guard<mutex> l(lock);
+	vector<idx_t> candidates;
+	for (idx_t i = 0; i < replicas.size(); i++) {
+		// round-robin starts at the next replica in line
+		auto replica_index = (next_replica + i) % replicas.size();
+		auto &replica = replicas[replica_index];
+		auto seconds_since_check = std::chrono::duration_cast<std::chrono::seconds>(now - replica.checked_at).count();
+		if (!replica.available && seconds_since_check < RECHECK_SECONDS) {
+			continue;
+		}
+		candidates.push_back(replica_index);
+	}
+	next_replica = (next_replica + 1) % replicas.size();
+	if (policy == MySQLReplicaPolicy::LEAST_LOADED) {
+		std::stable_sort(candidates.begin(), candidates.end(), [&](idx_t a, idx_t b) {
+			return replicas[a].active_transactions < replicas[b].active_transactions;
+		});
+	}
+	return candidates;
+}
+
+void MySQLReplicaRouter::SetAvailable(idx_t replica_index, bool available,
+                                      std::chrono::steady_clock::time_point now) {
+	lock_guard<mutex> l(lock);
+	auto &replica = replicas[replica_index];
+	replica.available = available;
+	replica.checked = true;
+	replica.checked_at = now;
+}
+
+bool MySQLReplicaRouter::NeedsLagCheck(idx_t replica_index, std::chrono::steady_clock::time_point now) {
+	if (max_lag < 0) {
+		return false;
+	}
+	lock_guard<mutex> l(lock);
+	auto &replica = replicas[replica_index];
+	if (!replica.checked || !replica.available) {
+		return true;
+	}
+	auto seconds_since_check = std::chrono::duration_cast<std::chrono::seconds>(now - replica.checked_at).count();
+	return seconds_since_check >= LAG_CHECK_SECONDS;
+}
+
+optional_idx MySQLReplicaRouter::Acquire(ClientContext &context, MySQLConnection &connection) {
+	auto now = std::chrono::steady_clock::now();
+	for (auto replica_index : GetCandidates(now)) {
+		auto &connection_pool = *replicas[replica_index].connection_pool;
+		try {
+			connection = connection_pool.Acquire(context);
+		} catch (std::exception &) {
+			// the replica cannot be reached - try the next one
+			SetAvailable(replica_index, false, now);
+			continue;
+		}
+		if (NeedsLagCheck(replica_index, now)) {
+			int64_t lag;
+			try {
+				lag = GetReplicationLag(context, connection);
+			} catch (std::exception &) {
+				// e.g. the user lacks the REPLICATION CLIENT privilege - the lag cannot be verified
+				lag = -1;
+			}
+			auto available = lag >= 0 && lag <= max_lag;
+			SetAvailable(replica_index, available, now);
+			if (!available) {
+				connection_pool.Release(std::move(connection));
+				continue;
+			}
+		}
+		lock_guard<mutex> l(lock);
+		replicas[replica_index].available = true;
+		replicas[replica_index].active_transactions++;
+		return replica_index;
+	}
+	return optional_idx();
+}
+
+void MySQLReplicaRouter::Finish(idx_t replica_index) {
+	lock_guard<mutex> l(lock);
+	D_ASSERT(replicas[replica_index].active_transactions > 0);
+	replicas[replica_index].active_transactions--;
+}
+
+shared_ptr<MySQLConnectionPool> MySQLReplicaRouter::GetConnectionPool(idx_t replica_index) {
+	return replicas[replica_index].connection_pool;
+}
+
+} // namespace duckdb
@@ -0,0 +1,96 @@
+#include "mysql_result_cache.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+MySQLResultCacheConfig MySQLResultCacheConfig::FromContext(ClientContext &context) {
+	MySQLResultCacheConfig result;
+	Value setting;
+	if (context.TryGetCurrentSetting("mysql_result_cache_ttl", setting)) {
+		result.ttl = UBigIntValue::Get(setting);
+	}
+	if (context.TryGetCurrentSetting("mysql_result_cache_max_bytes", setting)) {
+		result.max_bytes = UBigIntValue::Get(setting);
+	}
+	return result;
+}
+
+MySQLCachedResult::MySQLCachedResult(vector<string> names_p, vector<LogicalType> types_p)
+    : names(std::move(names_p)), types(std::move(types_p)) {
+	collection = make_uniq<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+}
+
+shared_ptr<MySQLCachedResult> MySQLResultCache::Lookup(const string &query, const MySQLResultCacheConfig &config) {
+	lock_guard<mutex> l(lock);
+	auto entry = entries.find(query);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	auto now = std::chrono::steady_clock::now();
+	auto age = std::chrono::duration_cast<std::chrono::seconds>(now - entry->second.created).count();
+	if (age < 0 || idx_t(age) >= config.ttl) {
+		EraseEntry(entry);
+		return nullptr;
+	}
+	entry->second.last_used = ++use_counter;
+	return entry->second.result;
+}
+
+void MySQLResultCache::Store(const string &query, const string &table, shared_ptr<MySQLCachedResult> result,
+                             const MySQLResultCacheConfig &config) {
+	auto size = result->collection->SizeInBytes();
+	if (size > config.max_bytes) {
+		return;
+	}
+	lock_guard<mutex> l(lock);
+	auto existing = entries.find(query);
+	if (existing != entries.end()) {
+		EraseEntry(existing);
+	}
+	// evict the least recently used results until the new result fits
+	while (!entries.empty() && total_size + size > config.max_bytes) {
+		auto lru_entry = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.last_used < lru_entry->second.last_used) {
+				lru_entry = it;
+			}
+		}
+		EraseEntry(lru_entry);
+	}
+	CachedEntry entry;
+	entry.result = std::move(result);
+	entry.table = table;
+	entry.size = size;
+	entry.created = std::chrono::steady_clock::now();
+	entry.last_used = ++use_counter;
+	total_size += size;
+	entries[query] = std::move(entry);
+}
+
+void MySQLResultCache::InvalidateTable(const string &table) {
+	lock_guard<mutex> l(lock);
+	for (auto it = entries.begin(); it != entries.end();) {
+		auto current = it++;
+		if (current->second.table.empty() || current->second.table == table) {
+			EraseEntry(current);
+		}
+	}
+}
+
+void MySQLResultCache::Clear() {
+	lock_guard<mutex> l(lock);
+	entries.clear();
+	total_size = 0;
+}
+
+string MySQLResultCache::GetTableKey(const string &schema_name, const string &table_name) {
+	return StringUtil::Lower(schema_name) + "." + StringUtil::Lower(table_name);
+}
+
+void MySQLResultCache::EraseEntry(unordered_map<string, CachedEntry>::iterator entry) {
+	total_size -= entry->second.size;
+	entries.erase(entry);
+}
+
+} // namespace duckdb
@@ -0,0 +1,94 @@
+#include "mysql_row_prefetcher.hpp"
+
+namespace duckdb {
+
+void MySQLRowBatch::AppendRow(MySQLResult &result) {
+	for (idx_t c = 0; c < column_count; c++) {
+		offsets.push_back(data.size());
+		if (result.IsNull(c)) {
+			lengths.push_back(DConstants::INVALID_INDEX);
+			continue;
+		}
+		auto value = result.GetStringT(c);
+		data.insert(data.end(), value.GetData(), value.GetData() + value.GetSize());
+		lengths.push_back(value.GetSize());
+	}
+	row_count++;
+}
+
+MySQLRowPrefetcher::MySQLRowPrefetcher(unique_ptr<MySQLResult> result_p, idx_t column_count,
+                                       optional_ptr<BufferManager> buffer_manager)
+    : result(std::move(result_p)), column_count(column_count), buffer_manager(buffer_manager), cancelled(false) {
+	fetch_thread = thread([this]() { FetchRows(); });
+}
+
+MySQLRowPrefetcher::~MySQLRowPrefetcher() {
+	{
+		lock_guard<mutex> l(lock);
+		cancelled = true;
+	}
+	batch_event.notify_all();
+	if (fetch_thread.joinable()) {
+		fetch_thread.join();
+	}
+	// the result is destroyed after the thread has finished - closing the connection if not all rows were read
+	result.reset();
+}
+
+void MySQLRowPrefetcher::FetchRows() {
+	try {
+		bool exhausted = false;
+		while (!exhausted) {
+			auto batch = make_uniq<MySQLRowBatch>(column_count);
+			if (buffer_manager) {
+				batch->reservation = MySQLMemoryReservation(*buffer_manager);
+			}
+			while (batch->row_count < STANDARD_VECTOR_SIZE && batch->data.size() < MAX_BATCH_BYTES && !cancelled) {
+				if (!result->Next()) {
+					exhausted = true;
+					break;
+				}
+				batch->AppendRow(*result);
+				// throws if the batch does not fit within the memory limit
+				batch->reservation.Resize(batch->MemorySize());
+			}
+			unique_lock<mutex> l(lock);
+			batch_event.wait(l, [&]() { return cancelled || batches.size() < MAX_PENDING_BATCHES; });
+			if (cancelled) {
+				return;
+			}
+			if (batch->row_count > 0) {
+				batches.push_back(std::move(batch));
+			}
+			finished = exhausted;
+			l.unlock();
+			batch_event.notify_all();
+		}
+	} catch (std::exception &ex) {
+		{
+			lock_guard<mutex> l(lock);
+			error = ErrorData(ex);
+			finished = true;
+		}
+		batch_event.notify_all();
+	}
+}
+
+unique_ptr<MySQLRowBatch> MySQLRowPrefetcher::NextBatch() {
+	unique_lock<mutex> l(lock);
+	batch_event.wait(l, [&]() { return !batches.empty() || finished; });
+	if (batches.empty()) {
+		if (error.HasError()) {
+			error.Throw();
+		}
+		return nullptr;
+	}
+	auto batch = std::move(batches.front());
+	batches.pop_front();
+	l.unlock();
+	// the fetch thread can continue
+	batch_event.notify_all();
+	return batch;
+}
+
+} // namespace duckdb
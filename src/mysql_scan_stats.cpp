@@ -0,0 +1,133 @@
+#include "duckdb.hpp"
+
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "mysql_scanner.hpp"
+#include "mysql_scan_stats.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "storage/mysql_catalog.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Stats
+//===--------------------------------------------------------------------===//
+static string FormatMicros(int64_t micros) {
+	return StringUtil::Format("%.3fs", double(micros) / 1000000.0);
+}
+
+InsertionOrderPreservingMap<string> MySQLOperatorStats::ToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Statements"] = to_string(statements.load());
+	result["Rows Received"] = to_string(rows.load());
+	result["Bytes Received"] = StringUtil::BytesToHumanReadableString(bytes.load());
+	result["Query Time"] = FormatMicros(query_micros.load());
+	if (detailed) {
+		result["Fetch Time"] = FormatMicros(fetch_micros.load());
+		result["Decode Time"] = FormatMicros(decode_micros.load());
+	} else {
+		result["Fetch + Decode Time"] = FormatMicros(fetch_micros.load());
+	}
+	return result;
+}
+
+void MySQLStatsLog::Record(const MySQLOperatorStats &stats) {
+	MySQLOperatorStatsEntry entry;
+	entry.database_name = stats.database_name;
+	entry.operator_name = stats.operator_name;
+	entry.target = stats.target;
+	entry.detailed = stats.detailed;
+	entry.statements = stats.statements;
+	entry.rows = stats.rows;
+	entry.bytes = stats.bytes;
+	entry.query_micros = stats.query_micros;
+	entry.fetch_micros = stats.fetch_micros;
+	entry.decode_micros = stats.decode_micros;
+
+	lock_guard<mutex> l(lock);
+	entries.push_back(std::move(entry));
+	while (entries.size() > MAX_ENTRIES) {
+		entries.pop_front();
+	}
+}
+
+vector<MySQLOperatorStatsEntry> MySQLStatsLog::GetEntries() {
+	lock_guard<mutex> l(lock);
+	return vector<MySQLOperatorStatsEntry>(entries.begin(), entries.end());
+}
+
+void MySQLStatsLog::Clear() {
+	lock_guard<mutex> l(lock);
+	entries.clear();
+}
+
+//===--------------------------------------------------------------------===//
+// mysql_scan_stats
+//===--------------------------------------------------------------------===//
+struct MySQLScanStatsFunctionData : public TableFunctionData {
+	vector<MySQLOperatorStatsEntry> entries;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> MySQLScanStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("operator");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("target");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("statements");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("rows");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("bytes");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("query_time_ms");
+	return_types.emplace_back(LogicalType::DOUBLE);
+	names.emplace_back("fetch_time_ms");
+	return_types.emplace_back(LogicalType::DOUBLE);
+	names.emplace_back("decode_time_ms");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	auto result = make_uniq<MySQLScanStatsFunctionData>();
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &db_ref : databases) {
+		auto &catalog = db_ref.get().GetCatalog();
+		if (catalog.GetCatalogType() != "mysql") {
+			continue;
+		}
+		auto entries = catalog.Cast<MySQLCatalog>().GetStatsLog().GetEntries();
+		result->entries.insert(result->entries.end(), entries.begin(), entries.end());
+	}
+	return std::move(result);
+}
+
+static Value MicrosToMillis(int64_t micros) {
+	return Value::DOUBLE(double(micros) / 1000.0);
+}
+
+static void MySQLScanStatsExecute(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<MySQLScanStatsFunctionData>();
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		output.SetValue(0, count, Value(entry.database_name));
+		output.SetValue(1, count, Value(entry.operator_name));
+		output.SetValue(2, count, Value(entry.target));
+		output.SetValue(3, count, Value::UBIGINT(entry.statements));
+		output.SetValue(4, count, Value::UBIGINT(entry.rows));
+		output.SetValue(5, count, Value::UBIGINT(entry.bytes));
+		output.SetValue(6, count, MicrosToMillis(entry.query_micros));
+		output.SetValue(7, count, MicrosToMillis(entry.fetch_micros));
+		output.SetValue(8, count, entry.detailed ? MicrosToMillis(entry.decode_micros) : Value(LogicalType::DOUBLE));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+MySQLScanStatsFunction::MySQLScanStatsFunction()
+    : TableFunction("mysql_scan_stats", {}, MySQLScanStatsExecute, MySQLScanStatsBind) {
+}
+
+} // namespace duckdb
@@ -4,27 +4,263 @@
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "mysql_scanner.hpp"
 #include "mysql_result.hpp"
+#include "mysql_statement.hpp"
+#include "mysql_decoder.hpp"
 #include "storage/mysql_transaction.hpp"
 #include "storage/mysql_table_set.hpp"
 #include "mysql_filter_pushdown.hpp"
+#include "mysql_result_cache.hpp"
+#include "mysql_row_prefetcher.hpp"
+#include "mysql_memory_reservation.hpp"
+#include "mysql_scan_stats.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/main/query_profiler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "storage/mysql_catalog.hpp"
 
 namespace duckdb {
 
 struct MySQLGlobalState;
 
-struct MySQLLocalState : public LocalTableFunctionState {};
+//! Keeps fetched rows alive for as long as the strings of a vector point into them
+template <class T>
+class MySQLRowsBuffer : public VectorBuffer {
+public:
+	explicit MySQLRowsBuffer(T rows_p) : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), rows(std::move(rows_p)) {
+	}
+
+private:
+	T rows;
+};
+
+//! The result of a query that is being scanned - read either as text or over the binary protocol
+struct MySQLScanResult {
+	shared_ptr<MySQLResult> result;
+	unique_ptr<MySQLStatement> statement;
+	//! Fetches the rows of a streaming text result on a background thread (if enabled)
+	unique_ptr<MySQLRowPrefetcher> prefetcher;
+	//! Keeps the (buffered) result alive while output vectors reference its strings (zero-copy scans only)
+	buffer_ptr<VectorBuffer> result_buffer;
+
+	bool IsOpen() const {
+		return result || statement || prefetcher;
+	}
+	void Reset() {
+		prefetcher.reset();
+		result_buffer.reset();
+		result.reset();
+		statement.reset();
+	}
+	const buffer_ptr<VectorBuffer> &GetResultBuffer() {
+		if (!result_buffer) {
+			result_buffer = make_buffer<MySQLRowsBuffer<shared_ptr<MySQLResult>>>(result);
+		}
+		return result_buffer;
+	}
+};
+
+//! Ends the read-only snapshot transaction of a connection and returns it to the pool
+static void ReleaseSnapshotConnection(MySQLConnectionPool &pool, MySQLConnection connection) {
+	try {
+		connection.Execute("COMMIT");
+	} catch (...) {
+		// the connection is closed instead of being returned to the pool
+		return;
+	}
+	pool.Release(std::move(connection));
+}
+
+struct MySQLLocalState : public LocalTableFunctionState {
+	~MySQLLocalState() override {
+		// finish the current partition before handing the connection back
+		result.Reset();
+		if (!connection_pool) {
+			return;
+		}
+		if (snapshot_connection) {
+			ReleaseSnapshotConnection(*connection_pool, std::move(connection));
+		} else {
+			connection_pool->Release(std::move(connection));
+		}
+	}
+
+	//! The pool the connection was borrowed from (parallel scans only)
+	shared_ptr<MySQLConnectionPool> connection_pool;
+	//! The connection used to scan partitions (parallel scans only)
+	MySQLConnection connection;
+	//! Whether or not the connection is in a consistent snapshot transaction
+	bool snapshot_connection = false;
+	//! The result of the partition that is currently being scanned (parallel scans only)
+	MySQLScanResult result;
+	//! The index of the partition that is currently being scanned - partitions are handed out in order, so this is
+	//! the batch index of the scanned rows
+	idx_t partition_index = 0;
+};
 
 struct MySQLGlobalState : public GlobalTableFunctionState {
-	explicit MySQLGlobalState(unique_ptr<MySQLResult> result_p) : result(std::move(result_p)) {
+	MySQLGlobalState(vector<LogicalType> types_p, BufferManager &buffer_manager)
+	    : types(std::move(types_p)), buffer_manager(buffer_manager) {
+		for (auto &type : types) {
+			decoders.push_back(MySQLDecoder::GetDecodeFunction(type));
+		}
+	}
+	~MySQLGlobalState() override {
+		for (auto &connection : snapshot_connections) {
+			ReleaseSnapshotConnection(*connection_pool, std::move(connection));
+		}
+		if (stats_log) {
+			stats_log->Record(stats);
+		}
 	}
 
-	unique_ptr<MySQLResult> result;
-	DataChunk varchar_chunk;
+	//! The result of the scan (single-threaded scans only)
+	MySQLScanResult result;
+	//! The types of the columns that are scanned
+	vector<LogicalType> types;
+	//! The functions used to decode text-protocol values of each column
+	vector<mysql_decode_function_t> decoders;
+	//! The memory of fetched results is reserved in DuckDB's buffer pool
+	BufferManager &buffer_manager;
+	//! The pool from which each thread borrows its own connection (parallel scans only)
+	shared_ptr<MySQLConnectionPool> connection_pool;
+	//! The queries for each of the partitions (parallel scans only)
+	vector<string> partitions;
+	//! Connections that share one consistent snapshot, that have not been taken by a thread yet (parallel scans with
+	//! mysql_parallel_scan_consistent_snapshot only)
+	vector<MySQLConnection> snapshot_connections;
+	//! Whether or not partitions may only be scanned over the snapshot connections
+	bool consistent_snapshot = false;
+	//! Whether or not partitions are streamed from MySQL instead of buffered (parallel scans only)
+	bool streaming = false;
+	//! Whether or not partitions are read over the binary protocol (parallel scans only)
+	bool binary_protocol = false;
+	//! Whether or not streamed partitions are fetched on a background thread (parallel scans only)
+	bool pipelined = false;
+	//! The next partition to hand out
+	idx_t partition_idx = 0;
+	mutex lock;
+	//! The cached result that is scanned instead of querying MySQL (if any)
+	shared_ptr<MySQLCachedResult> cached_result;
+	ColumnDataScanState cache_scan_state;
+	//! The result that is collected while scanning, and cached once it has been read entirely (if any)
+	shared_ptr<MySQLCachedResult> pending_cache_result;
+	optional_ptr<MySQLResultCache> result_cache;
+	MySQLResultCacheConfig cache_config;
+	string cache_query;
+	string cache_table;
+	//! The VARCHAR and BLOB columns whose values reference the fetched rows instead of being copied (if any)
+	vector<idx_t> reference_columns;
+	//! The counters of the scan - recorded in the stats log of the catalog once the scan is finished
+	MySQLOperatorStats stats;
+	optional_ptr<MySQLStatsLog> stats_log;
+	//! The name and value of the watermark that is recorded once an incremental scan has read all rows, and the
+	//! transaction that records it when it commits (incremental scans only)
+	string watermark_name;
+	string next_watermark;
+	optional_ptr<MySQLTransaction> watermark_transaction;
+	//! The number of partitions that have been read entirely (parallel scans only)
+	atomic<idx_t> finished_partitions {0};
+
+	bool IsParallel() const {
+		return !partitions.empty();
+	}
+
+	void ScanCachedResult(shared_ptr<MySQLCachedResult> result) {
+		cached_result = std::move(result);
+		cached_result->collection->InitializeScan(cache_scan_state);
+	}
+
+	void CacheResult(MySQLResultCache &cache, const MySQLResultCacheConfig &config, string query, string table,
+	                 vector<string> names) {
+		result_cache = &cache;
+		cache_config = config;
+		cache_query = std::move(query);
+		cache_table = std::move(table);
+		pending_cache_result = make_shared_ptr<MySQLCachedResult>(std::move(names), types);
+	}
+
+	void AppendToCache(DataChunk &chunk) {
+		if (!pending_cache_result) {
+			return;
+		}
+		pending_cache_result->collection->Append(chunk);
+		if (pending_cache_result->collection->SizeInBytes() > cache_config.max_bytes) {
+			// the result is too large to be cached
+			pending_cache_result.reset();
+		}
+	}
+
+	void FinishCache() {
+		if (!pending_cache_result) {
+			return;
+		}
+		result_cache->Store(cache_query, cache_table, std::move(pending_cache_result), cache_config);
+		pending_cache_result.reset();
+	}
+
+	//! Called once all rows of the scan have been read
+	void FinishScan() {
+		FinishCache();
+		if (watermark_transaction) {
+			watermark_transaction->SetWatermarkOnCommit(watermark_name, next_watermark);
+			watermark_transaction = nullptr;
+		}
+	}
+
+	//! Decodes VARCHAR and BLOB values without copying them - only valid if the fetched rows stay valid after
+	//! fetching the next row, i.e. not for streaming results that are read directly
+	void ReferenceStrings() {
+		for (idx_t c = 0; c < types.size(); c++) {
+			auto type_id = types[c].id();
+			if (type_id != LogicalTypeId::VARCHAR && type_id != LogicalTypeId::BLOB) {
+				continue;
+			}
+			decoders[c] = MySQLDecoder::GetDecodeFunction(types[c], true);
+			reference_columns.push_back(c);
+		}
+	}
+
+	//! Makes the string columns of the output keep the rows they reference alive
+	void AddStringReferences(DataChunk &output, const buffer_ptr<VectorBuffer> &rows) {
+		for (auto c : reference_columns) {
+			StringVector::AddBuffer(output.data[c], rows);
+		}
+	}
+
+	void InitializeStats(ClientContext &context, MySQLCatalog &catalog, string operator_name, string target) {
+		stats_log = &catalog.GetStatsLog();
+		stats.database_name = catalog.GetName();
+		stats.operator_name = std::move(operator_name);
+		stats.target = std::move(target);
+		// timing every row is only worth it when the query is being profiled
+		stats.detailed = QueryProfiler::Get(context).IsEnabled();
+	}
+
+	bool TryGetSnapshotConnection(MySQLConnection &connection) {
+		lock_guard<mutex> l(lock);
+		if (snapshot_connections.empty()) {
+			return false;
+		}
+		connection = std::move(snapshot_connections.back());
+		snapshot_connections.pop_back();
+		return true;
+	}
+
+	bool GetNextPartition(string &query, idx_t &index) {
+		lock_guard<mutex> l(lock);
+		if (partition_idx >= partitions.size()) {
+			return false;
+		}
+		index = partition_idx;
+		query = partitions[partition_idx++];
+		return true;
+	}
 
 	idx_t MaxThreads() const override {
-		return 1;
+		return IsParallel() ? partitions.size() : 1;
 	}
 };
 
@@ -33,47 +269,599 @@ static unique_ptr<FunctionData> MySQLBind(ClientContext &context, TableFunctionB
 	throw InternalException("MySQLBind");
 }
 
+static bool IsPartitionableType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Whether or not the results of serial scans are streamed from MySQL (mysql_use_result) instead of being buffered
+//! entirely by libmysql (mysql_store_result) before the first row is read
+static bool UseStreamingResults(ClientContext &context) {
+	Value streaming;
+	if (!context.TryGetCurrentSetting("mysql_streaming_results", streaming)) {
+		return false;
+	}
+	return BooleanValue::Get(streaming);
+}
+
+static bool UseBinaryProtocol(ClientContext &context) {
+	Value binary_protocol;
+	if (!context.TryGetCurrentSetting("mysql_binary_protocol", binary_protocol)) {
+		return false;
+	}
+	return BooleanValue::Get(binary_protocol);
+}
+
+//! Whether or not streaming text results are fetched on a background thread while the previous rows are decoded
+static bool UsePipelinedScan(ClientContext &context) {
+	Value pipelined;
+	if (!context.TryGetCurrentSetting("mysql_pipelined_scan", pipelined)) {
+		return false;
+	}
+	return BooleanValue::Get(pipelined);
+}
+
+static bool UseZeroCopyStrings(ClientContext &context) {
+	Value zero_copy;
+	if (!context.TryGetCurrentSetting("mysql_zero_copy_strings", zero_copy)) {
+		return false;
+	}
+	return BooleanValue::Get(zero_copy);
+}
+
+//! Enables zero-copy strings for the scan (if requested) - rows of streaming results that are not pipelined are
+//! overwritten by the next row, so their strings are always copied
+static void ConfigureZeroCopyStrings(ClientContext &context, MySQLGlobalState &gstate, bool streaming, bool pipelined) {
+	if (UseZeroCopyStrings(context) && (!streaming || pipelined)) {
+		gstate.ReferenceStrings();
+	}
+}
+
+//! Accounts the client memory of a buffered text result against DuckDB's memory limit
+//! Throws an OutOfMemoryException if the result does not fit
+static void ReserveResultMemory(BufferManager &buffer_manager, MySQLResult &result) {
+	if (result.IsStreaming()) {
+		return;
+	}
+	MySQLMemoryReservation reservation(buffer_manager);
+	reservation.Resize(result.GetBufferedSize());
+	result.SetReservation(std::move(reservation));
+}
+
+//! Whether or not the buffered result of a table scan is expected to fit in the memory that DuckDB has left - estimated
+//! from the row count and average row size of the table, and the pushed down LIMIT. Results that cannot be estimated
+//! (e.g. of pushed down aggregates, or if the statistics of the table have not been loaded) are assumed to fit.
+static bool ResultFitsInMemory(const MySQLBindData &bind_data, BufferManager &buffer_manager, idx_t column_count) {
+	if (!bind_data.query.empty() || bind_data.names.empty()) {
+		return true;
+	}
+	auto table_stats = bind_data.table.TryGetTableStatistics();
+	if (!table_stats) {
+		return true;
+	}
+	auto rows = table_stats->cardinality;
+	if (bind_data.limit_rows.IsValid()) {
+		rows = MinValue<idx_t>(rows, bind_data.limit_rows.GetIndex());
+	}
+	// only the scanned columns are transferred
+	auto row_size = MaxValue<idx_t>(table_stats->average_row_size * column_count / bind_data.names.size(), 1);
+	auto estimated_size = static_cast<double>(rows) * static_cast<double>(row_size);
+	auto max_memory = buffer_manager.GetMaxMemory();
+	auto used_memory = buffer_manager.GetUsedMemory();
+	auto available_memory = max_memory > used_memory ? max_memory - used_memory : 0;
+	// leave room for the rest of the query
+	return estimated_size <= static_cast<double>(available_memory) / 2;
+}
+
+static void RunScanQuery(MySQLConnection &con, const string &query, const vector<LogicalType> &types,
+                         bool binary_protocol, bool streaming, bool pipelined, MySQLOperatorStats &stats,
+                         MySQLScanResult &result, BufferManager &buffer_manager,
+                         const vector<Value> &parameters = vector<Value>(), idx_t statement_cache_size = 0) {
+	auto start = std::chrono::steady_clock::now();
+	if (binary_protocol) {
+		result.statement = con.QueryPrepared(query, types, streaming, parameters, statement_cache_size);
+	} else {
+		auto mysql_result = con.Query(query, nullptr, streaming);
+		if (streaming && pipelined) {
+			result.prefetcher = make_uniq<MySQLRowPrefetcher>(std::move(mysql_result), types.size(), &buffer_manager);
+		} else {
+			ReserveResultMemory(buffer_manager, *mysql_result);
+			result.result = std::move(mysql_result);
+		}
+	}
+	stats.statements++;
+	stats.query_micros += MySQLOperatorStats::ElapsedMicros(start);
+}
+
+//! The number of prepared statements that are kept per connection for re-use by later scans (0 to disable)
+static idx_t GetPreparedStatementCacheSize(ClientContext &context) {
+	Value cache_size;
+	if (!context.TryGetCurrentSetting("mysql_prepared_statement_cache_size", cache_size)) {
+		return 0;
+	}
+	return UBigIntValue::Get(cache_size);
+}
+
+static void AppendCondition(string &filter, const string &condition) {
+	if (condition.empty()) {
+		return;
+	}
+	filter = filter.empty() ? condition : filter + " AND " + condition;
+}
+
+static string GetScanQuery(const MySQLBindData &bind_data, const string &select, const string &filter) {
+	auto result = select;
+	if (!filter.empty()) {
+		result += " WHERE " + filter;
+	}
+	result += bind_data.order_by;
+	result += bind_data.limit;
+	return result;
+}
+
+//! Whether or not results are read from (and stored in) the result cache
+//! Results read within a transaction could include changes that the transaction has not committed yet - so we only
+//! use the cache when the transaction cannot have made any changes
+static bool UseResultCache(ClientContext &context, Catalog &catalog, MySQLResultCacheConfig &config) {
+	config = MySQLResultCacheConfig::FromContext(context);
+	return config.Enabled() && MySQLTransaction::CanUseSeparateConnection(context, catalog);
+}
+
+//! Whether or not the result of a query passed to mysql_query can be cached - only single SELECT statements that do
+//! not call functions whose result differs between runs (e.g. NOW() or RAND()) or read variables are cached
+static bool IsCacheableQuery(const string &query) {
+	static const case_insensitive_set_t NON_DETERMINISTIC_FUNCTIONS {
+	    "benchmark", "connection_id", "curdate", "current_date", "current_role", "current_time", "current_timestamp",
+	    "current_user", "curtime", "database", "found_rows", "get_lock", "is_free_lock", "is_used_lock",
+	    "last_insert_id", "localtime", "localtimestamp", "now", "rand", "random_bytes", "release_lock", "row_count",
+	    "schema", "session_user", "sleep", "sysdate", "system_user", "unix_timestamp", "user", "utc_date", "utc_time",
+	    "utc_timestamp", "uuid", "uuid_short"};
+	auto sql = query;
+	StringUtil::Trim(sql);
+	while (!sql.empty() && sql.back() == ';') {
+		sql.pop_back();
+		StringUtil::RTrim(sql);
+	}
+	if (sql.size() <= 6 || !StringUtil::CIEquals(sql.substr(0, 6), "select") ||
+	    !(StringUtil::CharacterIsSpace(sql[6]) || sql[6] == '(')) {
+		return false;
+	}
+	// multi-statements and variables (@var, @@var) - semicolons or @ inside of literals make us skip the cache as well
+	if (sql.find(';') != string::npos || sql.find('@') != string::npos) {
+		return false;
+	}
+	idx_t word_start = 0;
+	for (idx_t i = 0; i <= sql.size(); i++) {
+		if (i < sql.size() && (StringUtil::CharacterIsAlphaNumeric(sql[i]) || sql[i] == '_')) {
+			continue;
+		}
+		if (i > word_start && NON_DETERMINISTIC_FUNCTIONS.count(sql.substr(word_start, i - word_start))) {
+			return false;
+		}
+		word_start = i + 1;
+	}
+	return true;
+}
+
+//! Whether or not all connections of a parallel scan should read from the same snapshot
+static bool UseConsistentSnapshot(ClientContext &context) {
+	Value consistent_snapshot;
+	if (!context.TryGetCurrentSetting("mysql_parallel_scan_consistent_snapshot", consistent_snapshot)) {
+		return false;
+	}
+	return BooleanValue::Get(consistent_snapshot);
+}
+
+static bool UseParallelScan(ClientContext &context, const MySQLBindData &bind_data) {
+	Value parallel_scan;
+	if (!context.TryGetCurrentSetting("mysql_parallel_scan", parallel_scan) || !BooleanValue::Get(parallel_scan)) {
+		return false;
+	}
+	if (!bind_data.limit.empty()) {
+		// a pushed down LIMIT applies to the entire result - we cannot split it
+		return false;
+	}
+	if (!bind_data.query.empty()) {
+		// the scan has been replaced by a query that cannot be split
+		return false;
+	}
+	if (bind_data.seeded_sample) {
+		// every partition would pick its rows from the start of the same random sequence - so the sample would neither
+		// be random across partitions nor repeatable for a different number of partitions
+		return false;
+	}
+	// partitions are scanned on separate connections
+	return MySQLTransaction::CanUseSeparateConnection(context, bind_data.table.catalog);
+}
+
+//! Whether or not the table can be split into ranges of its primary key - which has to be a single integer column
+static bool HasPartitionableKey(const MySQLTableEntry &table) {
+	if (table.primary_key.size() != 1) {
+		return false;
+	}
+	auto &pk_column = table.GetColumn(table.primary_key[0]);
+	return IsPartitionableType(pk_column.GetType());
+}
+
+//! Whether or not scans of partitioned tables prune partitions, and parallel scans split them by partition
+static bool UsePartitionScan(ClientContext &context) {
+	Value partition_scan;
+	if (!context.TryGetCurrentSetting("mysql_partition_scan", partition_scan)) {
+		return true;
+	}
+	return BooleanValue::Get(partition_scan);
+}
+
+static string GetPartitionClause(const MySQLTablePartitions &partitions, const vector<idx_t> &partition_indexes) {
+	vector<string> names;
+	for (auto partition_idx : partition_indexes) {
+		names.push_back(MySQLUtils::WriteIdentifier(partitions.partitions[partition_idx].name));
+	}
+	return " PARTITION (" + StringUtil::Join(names, ", ") + ")";
+}
+
+//! Splits a scan of a partitioned table into queries that each read a group of consecutive partitions
+//! Partitions are natural units of work - there are at most as many groups as threads, balanced by the estimated row
+//! counts of the partitions
+static vector<string> GetTablePartitionScans(ClientContext &context, const string &select, const string &filter_string,
+                                             const MySQLTablePartitions &partitions,
+                                             const vector<idx_t> &partition_indexes) {
+	auto max_groups = MaxValue<idx_t>(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads()), 1);
+	// every partition weighs at least 1 - so partitions without (estimated) rows are still spread out
+	idx_t total_weight = 0;
+	for (auto partition_idx : partition_indexes) {
+		total_weight += partitions.partitions[partition_idx].estimated_rows + 1;
+	}
+	auto target_weight = (total_weight + max_groups - 1) / max_groups;
+	vector<vector<idx_t>> groups;
+	idx_t group_weight = 0;
+	for (auto partition_idx : partition_indexes) {
+		if (groups.empty() || (group_weight >= target_weight && groups.size() < max_groups)) {
+			groups.emplace_back();
+			group_weight = 0;
+		}
+		groups.back().push_back(partition_idx);
+		group_weight += partitions.partitions[partition_idx].estimated_rows + 1;
+	}
+	vector<string> result;
+	for (auto &group : groups) {
+		auto query = select + GetPartitionClause(partitions, group);
+		if (!filter_string.empty()) {
+			query += " WHERE " + filter_string;
+		}
+		result.push_back(std::move(query));
+	}
+	return result;
+}
+
+//! Splits a query into "partitions" queries that each read one range of the values of an integer column
+//! The first and last ranges are unbounded, so that rows outside of [min_val, max_val] are read as well. If the column
+//! is nullable, rows where it is NULL are read by the first partition.
+static vector<string> GetRangePartitions(const string &select, const string &filter_string, const string &column_name,
+                                         bool nullable, hugeint_t min_val, hugeint_t max_val, idx_t partitions) {
+	vector<string> result;
+	auto range = max_val - min_val + hugeint_t(1);
+	auto step = range / hugeint_t(static_cast<int64_t>(partitions));
+	for (idx_t p = 0; p < partitions; p++) {
+		vector<string> conditions;
+		if (!filter_string.empty()) {
+			conditions.push_back("(" + filter_string + ")");
+		}
+		if (p > 0) {
+			auto lower_bound = min_val + step * hugeint_t(static_cast<int64_t>(p));
+			conditions.push_back(column_name + " >= " + Hugeint::ToString(lower_bound));
+		}
+		if (p + 1 < partitions) {
+			auto upper_bound = min_val + step * hugeint_t(static_cast<int64_t>(p + 1));
+			auto condition = column_name + " < " + Hugeint::ToString(upper_bound);
+			if (nullable && p == 0) {
+				condition = "(" + condition + " OR " + column_name + " IS NULL)";
+			}
+			conditions.push_back(std::move(condition));
+		}
+		string partition_query = select;
+		if (!conditions.empty()) {
+			partition_query += " WHERE " + StringUtil::Join(conditions, " AND ");
+		}
+		result.push_back(std::move(partition_query));
+	}
+	return result;
+}
+
+//! Splits the scan of a table into ranges over its (integer) primary key
+static vector<string> GetScanPartitions(ClientContext &context, const MySQLBindData &bind_data, const string &select,
+                                        const string &filter_string, bool consistent_snapshot) {
+	vector<string> result;
+	auto &table = bind_data.table;
+	auto pk_name = MySQLUtils::WriteIdentifier(table.primary_key[0]);
+
+	// fetch the bounds of the primary key - this is answered directly from the index
+	string bounds_query = "SELECT MIN(" + pk_name + "), MAX(" + pk_name + ") FROM ";
+	bounds_query += MySQLUtils::WriteIdentifier(table.schema.name);
+	bounds_query += ".";
+	bounds_query += MySQLUtils::WriteIdentifier(table.name);
+	// the first and last partitions are unbounded - so the bounds do not need to come from the scanned snapshot
+	// for consistent snapshots they are read over a separate connection, so the transaction can join the snapshot
+	unique_ptr<MySQLResult> bounds;
+	auto &connection_pool = MySQLTransaction::Get(context, table.catalog).GetConnectionPool();
+	MySQLConnection bounds_connection;
+	if (consistent_snapshot) {
+		bounds_connection = connection_pool.Acquire(context);
+		bounds = bounds_connection.Query(bounds_query);
+	} else {
+		auto &transaction = MySQLTransaction::Get(context, table.catalog);
+		bounds = transaction.Query(bounds_query);
+	}
+	if (!bounds->Next() || bounds->IsNull(0) || bounds->IsNull(1)) {
+		// empty table
+		return result;
+	}
+	auto min_val = Value(bounds->GetString(0)).DefaultCastAs(LogicalType::HUGEINT).GetValue<hugeint_t>();
+	auto max_val = Value(bounds->GetString(1)).DefaultCastAs(LogicalType::HUGEINT).GetValue<hugeint_t>();
+	bounds.reset();
+	if (bounds_connection.IsOpen()) {
+		connection_pool.Release(std::move(bounds_connection));
+	}
+
+	// figure out how many partitions to create
+	idx_t partition_size = 1000000;
+	Value partition_size_setting;
+	if (context.TryGetCurrentSetting("mysql_parallel_scan_partition_size", partition_size_setting)) {
+		partition_size = MaxValue<idx_t>(UBigIntValue::Get(partition_size_setting), 1);
+	}
+	auto range = max_val - min_val + hugeint_t(1);
+	auto max_partitions = hugeint_t(static_cast<int64_t>(TaskScheduler::GetScheduler(context).NumberOfThreads()));
+	auto partition_count = (range + hugeint_t(static_cast<int64_t>(partition_size - 1))) /
+	                       hugeint_t(static_cast<int64_t>(partition_size));
+	if (partition_count > max_partitions) {
+		partition_count = max_partitions;
+	}
+	if (partition_count <= hugeint_t(1)) {
+		return result;
+	}
+	result = GetRangePartitions(select, filter_string, pk_name, false, min_val, max_val,
+	                            Hugeint::Cast<idx_t>(partition_count));
+	if (bind_data.primary_key_order != OrderType::INVALID) {
+		// every partition is read in key order, and the partitions are emitted in the order in which they are handed
+		// out (see MySQLScanGetPartitionData) - so a descending scan hands out the highest range first
+		for (auto &partition : result) {
+			partition += bind_data.order_by;
+		}
+		if (bind_data.primary_key_order == OrderType::DESCENDING) {
+			std::reverse(result.begin(), result.end());
+		}
+	}
+	return result;
+}
+
+//! Fetches the current maximum of the watermark column (above the low watermark) of an incremental scan
+//! Returns an empty string if there are no rows above the low watermark
+static string GetHighWatermark(ClientContext &context, const MySQLBindData &bind_data) {
+	auto &table = bind_data.table;
+	auto &column = table.GetColumn(bind_data.watermark_column);
+	auto column_name = MySQLUtils::WriteIdentifier(column.GetName());
+	string query = "SELECT MAX(" + column_name + ") FROM ";
+	query += MySQLUtils::WriteIdentifier(table.schema.name) + "." + MySQLUtils::WriteIdentifier(table.name);
+	if (!bind_data.low_watermark.empty()) {
+		query += " WHERE " + MySQLFilterPushdown::TransformWatermark(column.GetName(), column.GetType(),
+		                                                             bind_data.low_watermark, string());
+	}
+	// the scan is bounded by the maximum, so exactly the rows up to the recorded watermark are read
+	auto &transaction = MySQLTransaction::Get(context, table.catalog);
+	auto result = transaction.Query(query);
+	if (!result->Next() || result->IsNull(0)) {
+		return string();
+	}
+	return result->GetString(0);
+}
+
 static unique_ptr<GlobalTableFunctionState> MySQLInitGlobalState(ClientContext &context,
                                                                  TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<MySQLBindData>();
+	auto statement_cache_size = GetPreparedStatementCacheSize(context);
 	// generate the SELECT statement
 	string select;
-	select += "SELECT ";
-	for (idx_t c = 0; c < input.column_ids.size(); c++) {
-		if (c > 0) {
-			select += ", ";
+	string filter_string;
+	string prepared_filter;
+	vector<Value> parameters;
+	// the partitions of a partitioned table that can hold matching rows
+	optional_ptr<const MySQLTablePartitions> table_partitions;
+	vector<idx_t> scanned_partitions;
+	bool pruned_all_partitions = false;
+	// the SELECT statement without a PARTITION clause
+	string table_select;
+	if (!bind_data.query.empty()) {
+		// the scan has been replaced by a query - e.g. a pushed down aggregate
+		select = bind_data.query;
+	} else {
+		// the row id is the (integer) primary key - this allows DELETE and UPDATE to identify the rows to modify
+		auto row_id_column = bind_data.table.GetRowIdColumn();
+		select += "SELECT ";
+		for (idx_t c = 0; c < input.column_ids.size(); c++) {
+			if (c > 0) {
+				select += ", ";
+			}
+			if (input.column_ids[c] == COLUMN_IDENTIFIER_ROW_ID) {
+				select += row_id_column.empty() ? "NULL" : MySQLUtils::WriteIdentifier(row_id_column);
+			} else {
+				auto &col = bind_data.table.GetColumn(LogicalIndex(input.column_ids[c]));
+				auto col_name = col.GetName();
+				select += MySQLUtils::WriteIdentifier(col_name);
+			}
+		}
+		select += " FROM ";
+		select += MySQLUtils::WriteIdentifier(bind_data.table.schema.name);
+		select += ".";
+		select += MySQLUtils::WriteIdentifier(bind_data.table.name);
+		if (UsePartitionScan(context) && bind_data.partitions) {
+			auto &partitions = *bind_data.partitions;
+			if (!partitions.partitions.empty()) {
+				table_partitions = &partitions;
+				table_select = select;
+				scanned_partitions = MySQLFilterPushdown::PrunePartitions(input.column_ids, input.filters,
+				                                                          bind_data.names, partitions);
+				if (scanned_partitions.empty()) {
+					// none of the partitions can hold matching rows
+					pruned_all_partitions = true;
+				} else if (scanned_partitions.size() < partitions.partitions.size()) {
+					select += GetPartitionClause(partitions, scanned_partitions);
+				}
+			}
+		}
+		filter_string = MySQLFilterPushdown::TransformFilters(input.column_ids, input.filters, bind_data.names);
+		if (statement_cache_size > 0) {
+			// the filter constants are sent as parameters - so scans that only differ in constants share a statement
+			prepared_filter = MySQLFilterPushdown::TransformFilters(input.column_ids, input.filters, bind_data.names,
+			                                                        &parameters);
+		}
+		AppendCondition(filter_string, bind_data.filter);
+		AppendCondition(prepared_filter, bind_data.filter);
+		if (pruned_all_partitions) {
+			AppendCondition(filter_string, "FALSE");
+			AppendCondition(prepared_filter, "FALSE");
 		}
-		if (input.column_ids[c] == COLUMN_IDENTIFIER_ROW_ID) {
-			select += "NULL";
+	}
+	string high_watermark;
+	if (!bind_data.watermark_column.empty()) {
+		// incremental scan - read the rows above the low watermark up to the current high watermark
+		high_watermark = GetHighWatermark(context, bind_data);
+		auto &column = bind_data.table.GetColumn(bind_data.watermark_column);
+		auto watermark_filter = high_watermark.empty()
+		                            ? string("FALSE")
+		                            : MySQLFilterPushdown::TransformWatermark(column.GetName(), column.GetType(),
+		                                                                      bind_data.low_watermark, high_watermark);
+		AppendCondition(filter_string, watermark_filter);
+		AppendCondition(prepared_filter, watermark_filter);
+	}
+	vector<LogicalType> types;
+	vector<string> names;
+	for (auto &column_id : input.column_ids) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			types.push_back(LogicalType::ROW_TYPE);
+			names.push_back("rowid");
 		} else {
-			auto &col = bind_data.table.GetColumn(LogicalIndex(input.column_ids[c]));
-			auto col_name = col.GetName();
-			select += MySQLUtils::WriteIdentifier(col_name);
+			types.push_back(bind_data.types[column_id]);
+			names.push_back(bind_data.names[column_id]);
 		}
 	}
-	select += " FROM ";
-	select += MySQLUtils::WriteIdentifier(bind_data.table.schema.name);
-	select += ".";
-	select += MySQLUtils::WriteIdentifier(bind_data.table.name);
-	string filter_string = MySQLFilterPushdown::TransformFilters(input.column_ids, input.filters, bind_data.names);
-	if (!filter_string.empty()) {
-		select += " WHERE " + filter_string;
+	auto result = make_uniq<MySQLGlobalState>(std::move(types), BufferManager::GetBufferManager(context));
+	auto binary_protocol = UseBinaryProtocol(context);
+	auto &mysql_catalog = bind_data.table.catalog.Cast<MySQLCatalog>();
+	result->InitializeStats(context, mysql_catalog, "scan", bind_data.table.name);
+	if (!bind_data.watermark_column.empty()) {
+		// without new rows the low watermark is kept
+		result->watermark_name = bind_data.watermark_name;
+		result->next_watermark = high_watermark.empty() ? bind_data.low_watermark : high_watermark;
+		if (!result->next_watermark.empty()) {
+			result->watermark_transaction = MySQLTransaction::Get(context, bind_data.table.catalog);
+		}
 	}
-	if (!bind_data.limit.empty()) {
-		select += bind_data.limit;
+	auto scan_query = GetScanQuery(bind_data, select, filter_string);
+	MySQLResultCacheConfig cache_config;
+	// incremental scans always read from MySQL - they only finish (and record their watermark) when they do
+	// samples pick different rows every time
+	auto use_result_cache = bind_data.watermark_column.empty() && !bind_data.sampled &&
+	                        UseResultCache(context, bind_data.table.catalog, cache_config);
+	if (use_result_cache) {
+		auto cached_result = mysql_catalog.GetResultCache().Lookup(scan_query, cache_config);
+		if (cached_result) {
+			result->ScanCachedResult(std::move(cached_result));
+			return std::move(result);
+		}
 	}
+	if (UseParallelScan(context, bind_data) && !pruned_all_partitions) {
+		// partitions are read concurrently - so the result of a parallel scan is not cached
+		auto consistent_snapshot = UseConsistentSnapshot(context);
+		vector<string> partitions;
+		if (scanned_partitions.size() > 1 && bind_data.primary_key_order == OrderType::INVALID) {
+			// scans in primary key order are split by key ranges instead - which can be read in order
+			partitions =
+			    GetTablePartitionScans(context, table_select, filter_string, *table_partitions, scanned_partitions);
+		} else if (HasPartitionableKey(bind_data.table)) {
+			partitions = GetScanPartitions(context, bind_data, select, filter_string, consistent_snapshot);
+		}
+		if (!partitions.empty()) {
+			result->connection_pool = MySQLTransaction::Get(context, bind_data.table.catalog).GetConnectionPoolPtr();
+			if (consistent_snapshot) {
+				// open one connection per partition up front - all of them reading the same snapshot
+				auto table_name = MySQLUtils::WriteIdentifier(bind_data.table.schema.name) + "." +
+				                  MySQLUtils::WriteIdentifier(bind_data.table.name);
+				auto &transaction = MySQLTransaction::Get(context, bind_data.table.catalog);
+				result->snapshot_connections =
+				    transaction.StartSnapshotConnections(context, partitions.size(), table_name);
+				result->consistent_snapshot = true;
+			}
+			result->partitions = std::move(partitions);
+			result->streaming = UseStreamingResults(context);
+			result->binary_protocol = binary_protocol;
+			result->pipelined = UsePipelinedScan(context);
+			ConfigureZeroCopyStrings(context, *result, result->streaming, result->pipelined);
+			return std::move(result);
+		}
+	}
+	if (use_result_cache) {
+		// a replaced query (e.g. a pushed down join) can read from other tables than the scanned table
+		auto cache_table = bind_data.query.empty()
+		                       ? MySQLResultCache::GetTableKey(bind_data.table.schema.name, bind_data.table.name)
+		                       : string();
+		result->CacheResult(mysql_catalog.GetResultCache(), cache_config, scan_query, std::move(cache_table),
+		                    std::move(names));
+	}
+	if (statement_cache_size > 0) {
+		// cached statements are read over the binary protocol
+		binary_protocol = true;
+		if (bind_data.query.empty()) {
+			scan_query = GetScanQuery(bind_data, select, prepared_filter);
+		}
+	}
+	select = std::move(scan_query);
 	// run the query
+	auto &buffer_manager = result->buffer_manager;
+	auto separate_connection = MySQLTransaction::CanUseSeparateConnection(context, bind_data.table.catalog);
+	auto streaming = UseStreamingResults(context);
+	auto pipelined = streaming && UsePipelinedScan(context);
+	if (!streaming && separate_connection && !ResultFitsInMemory(bind_data, buffer_manager, input.column_ids.size())) {
+		// the buffered result is not expected to fit in memory - stream it in bounded batches instead. This has to be
+		// decided up front, as libmysql only reports the size of a buffered result once it has been received entirely
+		streaming = true;
+		pipelined = true;
+	}
+	if (streaming && separate_connection) {
+		// stream the result over a dedicated connection - the connection is kept alive by the result
+		auto con = MySQLTransaction::Get(context, bind_data.table.catalog).GetConnectionPool().Acquire(context);
+		ConfigureZeroCopyStrings(context, *result, true, pipelined);
+		RunScanQuery(con, select, result->types, binary_protocol, true, pipelined, result->stats, result->result,
+		             buffer_manager, parameters, statement_cache_size);
+		return std::move(result);
+	}
 	auto &transaction = MySQLTransaction::Get(context, bind_data.table.catalog);
 	auto &con = transaction.GetConnection();
-	auto query_result = con.Query(select);
-	auto result = make_uniq<MySQLGlobalState>(std::move(query_result));
-
-	// generate the varchar chunk
-	vector<LogicalType> varchar_types;
-	for (idx_t c = 0; c < input.column_ids.size(); c++) {
-		varchar_types.push_back(LogicalType::VARCHAR);
+	try {
+		RunScanQuery(con, select, result->types, binary_protocol, false, false, result->stats, result->result,
+		             buffer_manager, parameters, statement_cache_size);
+	} catch (OutOfMemoryException &) {
+		if (!separate_connection) {
+			throw;
+		}
+		// the (under-)estimated buffered result does not fit in memory - stream it in bounded batches over a
+		// dedicated connection
+		result->result.Reset();
+		auto stream_con = MySQLTransaction::Get(context, bind_data.table.catalog).GetConnectionPool().Acquire(context);
+		RunScanQuery(stream_con, select, result->types, binary_protocol, true, true, result->stats, result->result,
+		             buffer_manager, parameters, statement_cache_size);
 	}
-	result->varchar_chunk.Initialize(Allocator::DefaultAllocator(), varchar_types);
+	ConfigureZeroCopyStrings(context, *result, false, false);
 	return std::move(result);
 }
 
@@ -82,94 +870,187 @@ static unique_ptr<LocalTableFunctionState> MySQLInitLocalState(ExecutionContext
 	return make_uniq<MySQLLocalState>();
 }
 
-void CastBoolFromMySQL(ClientContext &context, Vector &input, Vector &result, idx_t size) {
-	auto input_data = FlatVector::GetData<string_t>(input);
-	auto result_data = FlatVector::GetData<bool>(result);
-	for (idx_t r = 0; r < size; r++) {
-		if (FlatVector::IsNull(input, r)) {
-			FlatVector::SetNull(result, r, true);
-			continue;
-		}
-		auto str_data = input_data[r].GetData();
-		auto str_size = input_data[r].GetSize();
-		if (str_size == 0) {
-			throw BinderException(
-			    "Failed to cast MySQL boolean - expected 1 byte element but got element of size %d\n* SET "
-			    "mysql_tinyint1_as_boolean=false to disable loading TINYINT(1) columns as booleans\n* SET "
-			    "mysql_bit1_as_boolean=false to disable loading BIT(1) columns as booleans",
-			    str_size);
-		}
-		// booleans are EITHER binary "1" or "0" (BIT(1))
-		// OR a number
-		// in both cases we can figure out what value it is from the first character:
-		// \0 -> zero byte, false
-		// - -> negative number, false
-		// 0 -> zero number, false
-		if (*str_data == '\0' || *str_data == '0' || *str_data == '-') {
-			result_data[r] = false;
+static optional_ptr<MySQLScanResult> GetScanResult(MySQLGlobalState &gstate, MySQLLocalState &lstate) {
+	if (!gstate.IsParallel()) {
+		return &gstate.result;
+	}
+	if (lstate.result.IsOpen()) {
+		return &lstate.result;
+	}
+	if (!lstate.connection.IsOpen()) {
+		lstate.connection_pool = gstate.connection_pool;
+		if (gstate.TryGetSnapshotConnection(lstate.connection)) {
+			lstate.snapshot_connection = true;
+		} else if (gstate.consistent_snapshot) {
+			// all snapshot connections have been taken - the other threads scan the remaining partitions
+			return nullptr;
 		} else {
-			result_data[r] = true;
+			lstate.connection = lstate.connection_pool->Acquire();
 		}
 	}
+	// fetch the next partition to scan
+	string query;
+	if (!gstate.GetNextPartition(query, lstate.partition_index)) {
+		return nullptr;
+	}
+	RunScanQuery(lstate.connection, query, gstate.types, gstate.binary_protocol, gstate.streaming, gstate.pipelined,
+	             gstate.stats, lstate.result, gstate.buffer_manager);
+	return &lstate.result;
 }
 
-static void MySQLScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
-	auto &gstate = data.global_state->Cast<MySQLGlobalState>();
+template <bool DETAILED>
+static idx_t MySQLScanText(MySQLScanResult &scan_result, MySQLGlobalState &gstate, DataChunk &output) {
+	auto &result = *scan_result.result;
+	D_ASSERT(output.ColumnCount() == gstate.decoders.size());
+	auto start = std::chrono::steady_clock::now();
+	int64_t fetch_micros = 0;
+	idx_t bytes = 0;
 	idx_t r;
-	gstate.varchar_chunk.Reset();
 	for (r = 0; r < STANDARD_VECTOR_SIZE; r++) {
-		if (!gstate.result->Next()) {
+		std::chrono::steady_clock::time_point fetch_start;
+		if (DETAILED) {
+			fetch_start = std::chrono::steady_clock::now();
+		}
+		if (!result.Next()) {
 			// exhausted result
 			break;
 		}
+		if (DETAILED) {
+			fetch_micros += MySQLOperatorStats::ElapsedMicros(fetch_start);
+		}
+		// decode the values straight from the row into the output vectors
 		for (idx_t c = 0; c < output.ColumnCount(); c++) {
-			auto &vec = gstate.varchar_chunk.data[c];
-			if (gstate.result->IsNull(c)) {
-				FlatVector::SetNull(vec, r, true);
-			} else {
-				auto string_data = FlatVector::GetData<string_t>(vec);
-				string_data[r] = StringVector::AddStringOrBlob(vec, gstate.result->GetStringT(c));
+			if (result.IsNull(c)) {
+				FlatVector::SetNull(output.data[c], r, true);
+				continue;
+			}
+			auto value = result.GetStringT(c);
+			bytes += value.GetSize();
+			gstate.decoders[c](value, output.data[c], r);
+		}
+	}
+	if (r > 0 && !gstate.reference_columns.empty()) {
+		gstate.AddStringReferences(output, scan_result.GetResultBuffer());
+	}
+	auto total_micros = MySQLOperatorStats::ElapsedMicros(start);
+	auto &stats = gstate.stats;
+	stats.bytes += bytes;
+	if (DETAILED) {
+		stats.fetch_micros += fetch_micros;
+		stats.decode_micros += total_micros - fetch_micros;
+	} else {
+		stats.fetch_micros += total_micros;
+	}
+	return r;
+}
+
+static idx_t MySQLScanPrefetched(MySQLRowPrefetcher &prefetcher, MySQLGlobalState &gstate, DataChunk &output) {
+	D_ASSERT(output.ColumnCount() == gstate.decoders.size());
+	auto &stats = gstate.stats;
+	auto start = std::chrono::steady_clock::now();
+	auto batch = prefetcher.NextBatch();
+	stats.fetch_micros += MySQLOperatorStats::ElapsedMicros(start);
+	if (!batch) {
+		// exhausted result
+		return 0;
+	}
+	D_ASSERT(batch->row_count <= STANDARD_VECTOR_SIZE);
+	start = std::chrono::steady_clock::now();
+	for (idx_t r = 0; r < batch->row_count; r++) {
+		for (idx_t c = 0; c < output.ColumnCount(); c++) {
+			if (batch->IsNull(r, c)) {
+				FlatVector::SetNull(output.data[c], r, true);
+				continue;
 			}
+			gstate.decoders[c](batch->GetStringT(r, c), output.data[c], r);
 		}
 	}
-	if (r == 0) {
-		// done
+	auto row_count = batch->row_count;
+	stats.bytes += batch->data.size();
+	if (!gstate.reference_columns.empty()) {
+		// the output references the strings of the batch - hand the batch over to the output vectors
+		gstate.AddStringReferences(output, make_buffer<MySQLRowsBuffer<unique_ptr<MySQLRowBatch>>>(std::move(batch)));
+	}
+	stats.decode_micros += MySQLOperatorStats::ElapsedMicros(start);
+	return row_count;
+}
+
+static void MySQLScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+	auto &gstate = data.global_state->Cast<MySQLGlobalState>();
+	auto &lstate = data.local_state->Cast<MySQLLocalState>();
+	if (gstate.cached_result) {
+		gstate.cached_result->collection->Scan(gstate.cache_scan_state, output);
+		gstate.stats.rows += output.size();
 		return;
 	}
-	D_ASSERT(output.ColumnCount() == gstate.varchar_chunk.ColumnCount());
-	for (idx_t c = 0; c < output.ColumnCount(); c++) {
-		switch (output.data[c].GetType().id()) {
-		case LogicalTypeId::BLOB:
-			// blobs are sent over the wire as-is
-			output.data[c].Reinterpret(gstate.varchar_chunk.data[c]);
-			break;
-		case LogicalTypeId::BOOLEAN:
-			// booleans can be sent either as numbers ('0' or '1') or as bits ('\0' or
-			// '\1')
-			CastBoolFromMySQL(context, gstate.varchar_chunk.data[c], output.data[c], r);
-			break;
-		case LogicalTypeId::TIMESTAMP_TZ: {
-			string error;
-			VectorOperations::DefaultTryCast(gstate.varchar_chunk.data[c], output.data[c], r, &error);
-			break;
+	while (true) {
+		auto scan_result = GetScanResult(gstate, lstate);
+		if (!scan_result) {
+			// no partitions left
+			return;
 		}
-		default: {
-			string error;
-			VectorOperations::TryCast(context, gstate.varchar_chunk.data[c], output.data[c], r, &error);
-			break;
+		idx_t count;
+		if (scan_result->statement) {
+			// binary protocol - values are written directly into the output, so decoding is not timed separately
+			auto &statement = *scan_result->statement;
+			auto start = std::chrono::steady_clock::now();
+			auto bytes_fetched = statement.BytesFetched();
+			count = statement.Fetch(output);
+			gstate.stats.bytes += statement.BytesFetched() - bytes_fetched;
+			gstate.stats.fetch_micros += MySQLOperatorStats::ElapsedMicros(start);
+		} else if (scan_result->prefetcher) {
+			count = MySQLScanPrefetched(*scan_result->prefetcher, gstate, output);
+		} else if (gstate.stats.detailed) {
+			count = MySQLScanText<true>(*scan_result, gstate, output);
+		} else {
+			count = MySQLScanText<false>(*scan_result, gstate, output);
+		}
+		if (count > 0) {
+			gstate.stats.rows += count;
+			output.SetCardinality(count);
+			gstate.AppendToCache(output);
+			return;
 		}
+		if (!gstate.IsParallel()) {
+			// done
+			gstate.FinishScan();
+			return;
 		}
+		// this partition is exhausted - move on to the next one
+		lstate.result.Reset();
+		if (++gstate.finished_partitions == gstate.partitions.size()) {
+			gstate.FinishScan();
+		}
+	}
+}
+
+//! The rows of a partition form one batch - this lets DuckDB restore the order of the partitions (and so the order of
+//! the table, for scans in primary key order) while they are read in parallel
+static OperatorPartitionData MySQLScanGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	if (input.partition_info.RequiresPartitionColumns()) {
+		throw InternalException("MySQLScan::GetPartitionData: partition columns not supported");
 	}
-	output.SetCardinality(r);
+	auto &lstate = input.local_state->Cast<MySQLLocalState>();
+	return OperatorPartitionData(lstate.partition_index);
 }
 
 static InsertionOrderPreservingMap<string> MySQLScanToString(TableFunctionToStringInput &input) {
 	InsertionOrderPreservingMap<string> result;
 	auto &bind_data = input.bind_data->Cast<MySQLBindData>();
 	result["Table"] = bind_data.table.name;
+	if (!bind_data.query.empty()) {
+		result["Query"] = bind_data.query;
+	}
 	return result;
 }
 
+static InsertionOrderPreservingMap<string> MySQLScanDynamicToString(TableFunctionDynamicToStringInput &input) {
+	if (!input.global_state) {
+		return InsertionOrderPreservingMap<string>();
+	}
+	return input.global_state->Cast<MySQLGlobalState>().stats.ToString();
+}
+
 static void MySQLScanSerialize(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
                                const TableFunction &function) {
 	throw NotImplementedException("MySQLScanSerialize");
@@ -186,13 +1067,78 @@ static BindInfo MySQLGetBindInfo(const optional_ptr<FunctionData> bind_data_p) {
 	return info;
 }
 
+//! Pushes the filter expressions over the scan that MySQL can evaluate exactly into the WHERE clause of the scan while
+//! DuckDB's filters are pushed down - before the join order is chosen. This way the optimizer of MySQL can estimate
+//! how many rows match them (see MySQLScanCardinality), instead of DuckDB guessing the selectivity of the filters.
+static void MySQLScanPushdownFilters(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                     vector<unique_ptr<Expression>> &filters) {
+	auto &bind_data = bind_data_p->Cast<MySQLBindData>();
+	vector<string> column_names;
+	for (auto &column_id : get.GetColumnIds()) {
+		if (column_id.IsRowIdColumn()) {
+			column_names.emplace_back();
+		} else {
+			column_names.push_back(MySQLUtils::WriteIdentifier(bind_data.names[column_id.GetPrimaryIndex()]));
+		}
+	}
+	vector<unique_ptr<Expression>> remaining_filters;
+	for (auto &expr : filters) {
+		string condition;
+		bool exact = true;
+		if (!MySQLFilterPushdown::TransformExpression(*expr, get.table_index, column_names, condition, exact)) {
+			remaining_filters.push_back(std::move(expr));
+			continue;
+		}
+		// inexact conditions match a superset of the rows - they are only used for the estimate
+		AppendCondition(bind_data.estimate_filter, condition);
+		if (exact) {
+			AppendCondition(bind_data.filter, condition);
+		} else {
+			remaining_filters.push_back(std::move(expr));
+		}
+	}
+	filters = std::move(remaining_filters);
+}
+
+static unique_ptr<NodeStatistics> MySQLScanCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<MySQLBindData>();
+	if (!bind_data.estimate_filter.empty() && bind_data.query.empty()) {
+		idx_t filtered_cardinality;
+		if (bind_data.table.GetFilteredCardinality(context, bind_data.estimate_filter, filtered_cardinality)) {
+			return make_uniq<NodeStatistics>(filtered_cardinality);
+		}
+	}
+	Value use_statistics;
+	if (context.TryGetCurrentSetting("mysql_table_statistics", use_statistics) && !BooleanValue::Get(use_statistics)) {
+		return nullptr;
+	}
+	// the row count reported by MySQL is an estimate - so we cannot use it as maximum cardinality
+	return make_uniq<NodeStatistics>(bind_data.table.GetTableStatistics(context).cardinality);
+}
+
+static unique_ptr<BaseStatistics> MySQLScanStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                      column_t column_id) {
+	auto &bind_data = bind_data_p->Cast<MySQLBindData>();
+	if (!bind_data.query.empty()) {
+		// the columns no longer correspond to the columns of the table
+		return nullptr;
+	}
+	return bind_data.table.GetStatistics(context, column_id);
+}
+
 MySQLScanFunction::MySQLScanFunction()
     : TableFunction("mysql_scan", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}, MySQLScan,
                     MySQLBind, MySQLInitGlobalState, MySQLInitLocalState) {
 	to_string = MySQLScanToString;
+	dynamic_to_string = MySQLScanDynamicToString;
 	serialize = MySQLScanSerialize;
 	deserialize = MySQLScanDeserialize;
 	get_bind_info = MySQLGetBindInfo;
+	cardinality = MySQLScanCardinality;
+	statistics = MySQLScanStatistics;
+	get_partition_data = MySQLScanGetPartitionData;
+	// only enabled when mysql_explain_cardinality is set (see MySQLTableEntry::GetScanFunction)
+	pushdown_complex_filter = MySQLScanPushdownFilters;
 	projection_pushdown = true;
 }
 
@@ -205,8 +1151,21 @@ struct MySQLQueryBindData : public FunctionData {
 	}
 
 	Catalog &catalog;
+	//! The result of running the query while binding (only if the query could not be prepared)
 	unique_ptr<MySQLResult> result;
 	string query;
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The cached result of the query (if it was found in the result cache)
+	shared_ptr<MySQLCachedResult> cached_result;
+	//! The integer result column over which the query is split into ranges that are read in parallel (if any)
+	string partition_column;
+	//! The base table column the partition column is read from - empty if it is not read from a base table column
+	string partition_base_schema;
+	string partition_base_table;
+	string partition_base_column;
+	//! The number of ranges to split the query into
+	idx_t partition_count = 0;
 
 public:
 	unique_ptr<FunctionData> Copy() const override {
@@ -217,61 +1176,314 @@ public:
 	}
 };
 
-static unique_ptr<FunctionData> MySQLQueryBind(ClientContext &context, TableFunctionBindInput &input,
-                                               vector<LogicalType> &return_types, vector<string> &names) {
-	if (input.inputs[0].IsNull() || input.inputs[1].IsNull()) {
-		throw BinderException("Parameters to mysql_query cannot be NULL");
+static unique_ptr<MySQLResult> MySQLQueryExecute(ClientContext &context, Catalog &catalog, const string &sql) {
+	if (UseStreamingResults(context) && MySQLTransaction::CanUseSeparateConnection(context, catalog)) {
+		// stream the result over a dedicated connection - the connection is kept alive by the result
+		// for read-only databases this reads from the replica the transaction was routed to (if any)
+		auto con = MySQLTransaction::Get(context, catalog).GetConnectionPool().Acquire(context);
+		return con.Query(sql, &context, true);
 	}
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	return transaction.GetConnection().Query(sql, &context);
+}
 
-	// look up the database to query
-	auto db_name = input.inputs[0].GetValue<string>();
+static Catalog &GetMySQLCatalog(ClientContext &context, const string &db_name, const string &function_name) {
 	auto &db_manager = DatabaseManager::Get(context);
 	auto db = db_manager.GetDatabase(context, db_name);
 	if (!db) {
-		throw BinderException("Failed to find attached database \"%s\" referenced in mysql_query", db_name);
+		throw BinderException("Failed to find attached database \"%s\" referenced in %s", db_name, function_name);
 	}
 	auto &catalog = db->GetCatalog();
 	if (catalog.GetCatalogType() != "mysql") {
 		throw BinderException("Attached database \"%s\" does not refer to a MySQL database", db_name);
 	}
-	auto &transaction = MySQLTransaction::Get(context, catalog);
+	return catalog;
+}
+
+static unique_ptr<FunctionData> MySQLQueryBind(ClientContext &context, TableFunctionBindInput &input,
+                                               vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[0].IsNull() || input.inputs[1].IsNull()) {
+		throw BinderException("Parameters to mysql_query cannot be NULL");
+	}
+
+	// look up the database to query
+	auto &catalog = GetMySQLCatalog(context, input.inputs[0].GetValue<string>(), "mysql_query");
 	auto sql = input.inputs[1].GetValue<string>();
-	auto result = transaction.GetConnection().Query(sql, &context);
-	for (auto &field : result->Fields()) {
+	MySQLResultCacheConfig cache_config;
+	if (UseResultCache(context, catalog, cache_config) && IsCacheableQuery(sql)) {
+		auto cached_result = catalog.Cast<MySQLCatalog>().GetResultCache().Lookup(sql, cache_config);
+		if (cached_result) {
+			names = cached_result->names;
+			return_types = cached_result->types;
+			auto bind_data = make_uniq<MySQLQueryBindData>(catalog, nullptr, std::move(sql));
+			bind_data->names = names;
+			bind_data->types = return_types;
+			bind_data->cached_result = std::move(cached_result);
+			return std::move(bind_data);
+		}
+	}
+	// prepare the query to find out the result columns - so that the query is only run when it is executed
+	// the transaction connection is used as the query can refer to temporary tables of the session
+	unique_ptr<MySQLResult> result;
+	vector<MySQLField> fields;
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	if (!transaction.GetConnection().TryGetQueryFields(context, sql, fields)) {
+		// the query cannot be prepared - run it to find out the result columns instead
+		result = MySQLQueryExecute(context, catalog, sql);
+		fields = result->Fields();
+	}
+	for (auto &field : fields) {
 		names.push_back(field.name);
 		return_types.push_back(field.type);
 	}
-	return make_uniq<MySQLQueryBindData>(catalog, std::move(result), std::move(sql));
+	auto bind_data = make_uniq<MySQLQueryBindData>(catalog, std::move(result), std::move(sql));
+	bind_data->names = names;
+	bind_data->types = return_types;
+	for (auto &entry : input.named_parameters) {
+		if (entry.second.IsNull()) {
+			throw BinderException("mysql_query: \"%s\" cannot be NULL", entry.first);
+		}
+		if (entry.first == "partition_column") {
+			bind_data->partition_column = StringValue::Get(entry.second);
+		} else if (entry.first == "partitions") {
+			auto partitions = entry.second.GetValue<int64_t>();
+			if (partitions < 1) {
+				throw BinderException("mysql_query: \"partitions\" must be at least 1");
+			}
+			bind_data->partition_count = NumericCast<idx_t>(partitions);
+		}
+	}
+	if (bind_data->partition_column.empty()) {
+		if (bind_data->partition_count > 0) {
+			throw BinderException("mysql_query: \"partitions\" requires a \"partition_column\"");
+		}
+		return std::move(bind_data);
+	}
+	idx_t column_idx;
+	for (column_idx = 0; column_idx < names.size(); column_idx++) {
+		if (StringUtil::CIEquals(names[column_idx], bind_data->partition_column)) {
+			break;
+		}
+	}
+	if (column_idx >= names.size()) {
+		throw BinderException("mysql_query: the result of the query does not have a column named \"%s\"",
+		                      bind_data->partition_column);
+	}
+	if (!IsPartitionableType(return_types[column_idx])) {
+		throw BinderException("mysql_query: the partition column \"%s\" must be an integer column - got %s",
+		                      bind_data->partition_column, return_types[column_idx].ToString());
+	}
+	bind_data->partition_column = names[column_idx];
+	bind_data->partition_base_schema = fields[column_idx].base_schema;
+	bind_data->partition_base_table = fields[column_idx].base_table;
+	bind_data->partition_base_column = fields[column_idx].base_column;
+	if (bind_data->partition_count == 0) {
+		bind_data->partition_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	}
+	return std::move(bind_data);
+}
+
+//! Splits a query into ranges over an integer column of its result, by wrapping it as a derived table - the query
+//! is only split if the column is read from an indexed column of a base table, as the ranges are then found through
+//! an index lookup of the base table (rather than by running the query once more) and the range predicates can be
+//! pushed into index range scans
+static vector<string> GetQueryPartitions(ClientContext &context, MySQLQueryBindData &bind_data) {
+	if (bind_data.partition_base_schema.empty() || bind_data.partition_base_table.empty() ||
+	    bind_data.partition_base_column.empty()) {
+		// the column is computed by the query (or read from a view or derived table)
+		return vector<string>();
+	}
+	auto &transaction = MySQLTransaction::Get(context, bind_data.catalog);
+	auto index_query = "SELECT 1 FROM information_schema.statistics WHERE table_schema=" +
+	                   MySQLUtils::WriteLiteral(bind_data.partition_base_schema) +
+	                   " AND table_name=" + MySQLUtils::WriteLiteral(bind_data.partition_base_table) +
+	                   " AND column_name=" + MySQLUtils::WriteLiteral(bind_data.partition_base_column) +
+	                   " AND seq_in_index=1 LIMIT 1";
+	auto index = transaction.Query(index_query);
+	if (!index->Next()) {
+		// no index starts with the column - the bounds would require a full scan, as would every range
+		return vector<string>();
+	}
+	// trailing semicolons would end the derived table
+	auto query = bind_data.query;
+	StringUtil::RTrim(query);
+	while (!query.empty() && query.back() == ';') {
+		query.pop_back();
+		StringUtil::RTrim(query);
+	}
+	// the bounds of the base table column contain the values of the result column - as the first and last ranges
+	// are unbounded, the ranges cover the result even if the bounds of the base table are wider
+	auto base_column = MySQLUtils::WriteIdentifier(bind_data.partition_base_column);
+	auto bounds_query = "SELECT MIN(" + base_column + "), MAX(" + base_column + ") FROM " +
+	                    MySQLUtils::WriteIdentifier(bind_data.partition_base_schema) + "." +
+	                    MySQLUtils::WriteIdentifier(bind_data.partition_base_table);
+	auto bounds = transaction.Query(bounds_query);
+	if (!bounds->Next() || bounds->IsNull(0) || bounds->IsNull(1)) {
+		// the base table is empty, or the column is always NULL
+		return vector<string>();
+	}
+	auto min_val = Value(bounds->GetString(0)).DefaultCastAs(LogicalType::HUGEINT).GetValue<hugeint_t>();
+	auto max_val = Value(bounds->GetString(1)).DefaultCastAs(LogicalType::HUGEINT).GetValue<hugeint_t>();
+	auto range = max_val - min_val + hugeint_t(1);
+	auto partition_count = bind_data.partition_count;
+	if (range < hugeint_t(static_cast<int64_t>(partition_count))) {
+		partition_count = Hugeint::Cast<idx_t>(range);
+	}
+	if (partition_count <= 1) {
+		return vector<string>();
+	}
+	auto column_name = MySQLUtils::WriteIdentifier(bind_data.partition_column);
+	auto select = "SELECT * FROM (" + query + ") AS __duckdb_query";
+	return GetRangePartitions(select, string(), column_name, true, min_val, max_val, partition_count);
 }
 
 static unique_ptr<GlobalTableFunctionState> MySQLQueryInitGlobalState(ClientContext &context,
                                                                       TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->CastNoConst<MySQLQueryBindData>();
+	auto &mysql_catalog = bind_data.catalog.Cast<MySQLCatalog>();
+	auto result = make_uniq<MySQLGlobalState>(bind_data.types, BufferManager::GetBufferManager(context));
+	result->InitializeStats(context, mysql_catalog, "query", bind_data.query);
+	if (bind_data.cached_result) {
+		result->ScanCachedResult(bind_data.cached_result);
+		return std::move(result);
+	}
+	if (!bind_data.partition_column.empty() && !bind_data.result &&
+	    MySQLTransaction::CanUseSeparateConnection(context, bind_data.catalog)) {
+		// partitions are read concurrently - so the result of a partitioned query is not cached
+		auto partitions = GetQueryPartitions(context, bind_data);
+		if (!partitions.empty()) {
+			result->connection_pool = MySQLTransaction::Get(context, bind_data.catalog).GetConnectionPoolPtr();
+			result->partitions = std::move(partitions);
+			result->streaming = UseStreamingResults(context);
+			result->pipelined = UsePipelinedScan(context);
+			ConfigureZeroCopyStrings(context, *result, result->streaming, result->pipelined);
+			return std::move(result);
+		}
+	}
 	unique_ptr<MySQLResult> mysql_result;
 	if (bind_data.result) {
 		mysql_result = std::move(bind_data.result);
 	} else {
-		auto &transaction = MySQLTransaction::Get(context, bind_data.catalog);
-		mysql_result = transaction.GetConnection().Query(bind_data.query, &context);
+		auto start = std::chrono::steady_clock::now();
+		mysql_result = MySQLQueryExecute(context, bind_data.catalog, bind_data.query);
+		result->stats.query_micros += MySQLOperatorStats::ElapsedMicros(start);
 	}
-	auto column_count = mysql_result->ColumnCount();
-
-	auto result = make_uniq<MySQLGlobalState>(std::move(mysql_result));
-
-	// generate the varchar chunk
-	vector<LogicalType> varchar_types;
-	for (idx_t c = 0; c < column_count; c++) {
-		varchar_types.push_back(LogicalType::VARCHAR);
+	result->stats.statements++;
+	auto streaming = mysql_result->IsStreaming();
+	auto pipelined = streaming && UsePipelinedScan(context);
+	ConfigureZeroCopyStrings(context, *result, streaming, pipelined);
+	if (pipelined) {
+		result->result.prefetcher = make_uniq<MySQLRowPrefetcher>(std::move(mysql_result), bind_data.types.size(),
+		                                                          &result->buffer_manager);
+	} else {
+		ReserveResultMemory(result->buffer_manager, *mysql_result);
+		result->result.result = std::move(mysql_result);
+	}
+	MySQLResultCacheConfig cache_config;
+	if (UseResultCache(context, bind_data.catalog, cache_config) && IsCacheableQuery(bind_data.query)) {
+		// we do not know which tables the query reads from - so any write invalidates the result
+		auto &cache = mysql_catalog.GetResultCache();
+		result->CacheResult(cache, cache_config, bind_data.query, string(), bind_data.names);
 	}
-	result->varchar_chunk.Initialize(Allocator::DefaultAllocator(), varchar_types);
 	return std::move(result);
 }
 
 MySQLQueryFunction::MySQLQueryFunction()
     : TableFunction("mysql_query", {LogicalType::VARCHAR, LogicalType::VARCHAR}, MySQLScan, MySQLQueryBind,
                     MySQLQueryInitGlobalState, MySQLInitLocalState) {
+	named_parameters["partition_column"] = LogicalType::VARCHAR;
+	named_parameters["partitions"] = LogicalType::BIGINT;
+	dynamic_to_string = MySQLScanDynamicToString;
+	serialize = MySQLScanSerialize;
+	deserialize = MySQLScanDeserialize;
+}
+
+//===--------------------------------------------------------------------===//
+// MySQL Incremental Scan
+//===--------------------------------------------------------------------===//
+static bool IsWatermarkType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	default:
+		return IsPartitionableType(type);
+	}
+}
+
+//! Converts a watermark provided by the user to the text MySQL uses for values of the watermark column
+static string WatermarkToString(const Value &watermark, const LogicalType &type) {
+	if (type.id() == LogicalTypeId::TIMESTAMP_TZ) {
+		// MySQL TIMESTAMP values are written without time zone - as is done for pushed down filters
+		return watermark.DefaultCastAs(LogicalType::TIMESTAMP).ToString();
+	}
+	return watermark.DefaultCastAs(type).ToString();
+}
+
+static unique_ptr<FunctionData> MySQLScanIncrementalBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	for (auto &input_value : input.inputs) {
+		if (input_value.IsNull()) {
+			throw BinderException("Parameters to mysql_scan_incremental cannot be NULL");
+		}
+	}
+	auto &catalog = GetMySQLCatalog(context, input.inputs[0].GetValue<string>(), "mysql_scan_incremental");
+	auto schema_name = input.inputs[1].GetValue<string>();
+	auto table_name = input.inputs[2].GetValue<string>();
+	auto column_name = input.inputs[3].GetValue<string>();
+	auto &table = catalog.GetEntry<TableCatalogEntry>(context, schema_name, table_name).Cast<MySQLTableEntry>();
+	if (!table.ColumnExists(column_name)) {
+		throw BinderException("Table \"%s\" does not have a column named \"%s\"", table.name, column_name);
+	}
+	auto &column = table.GetColumn(column_name);
+	if (!IsWatermarkType(column.GetType())) {
+		throw BinderException("Column \"%s\" of type %s cannot be used as watermark - mysql_scan_incremental requires "
+		                      "an integer, decimal, date or timestamp column",
+		                      column.GetName(), column.GetType().ToString());
+	}
+
+	auto result = make_uniq<MySQLBindData>(table);
+	for (auto &col : table.GetColumns().Logical()) {
+		result->types.push_back(col.GetType());
+		result->names.push_back(col.GetName());
+	}
+	result->watermark_column = column.GetName();
+	result->watermark_name = table.schema.name + "." + table.name + "." + column.GetName();
+	bool has_watermark = false;
+	for (auto &entry : input.named_parameters) {
+		if (entry.first == "name") {
+			result->watermark_name = StringValue::Get(entry.second);
+		} else if (entry.first == "watermark") {
+			has_watermark = true;
+			if (!entry.second.IsNull()) {
+				result->low_watermark = WatermarkToString(entry.second, column.GetType());
+			}
+		}
+	}
+	if (!has_watermark) {
+		// continue from where the previous incremental scan with the same name left off
+		auto &mysql_catalog = catalog.Cast<MySQLCatalog>();
+		mysql_catalog.GetWatermarks().TryGet(result->watermark_name, result->low_watermark);
+	}
+	return_types = result->types;
+	names = result->names;
+	return std::move(result);
+}
+
+MySQLScanIncrementalFunction::MySQLScanIncrementalFunction()
+    : TableFunction("mysql_scan_incremental",
+                    {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}, MySQLScan,
+                    MySQLScanIncrementalBind, MySQLInitGlobalState, MySQLInitLocalState) {
+	named_parameters["watermark"] = LogicalType::ANY;
+	named_parameters["name"] = LogicalType::VARCHAR;
+	to_string = MySQLScanToString;
+	dynamic_to_string = MySQLScanDynamicToString;
 	serialize = MySQLScanSerialize;
 	deserialize = MySQLScanDeserialize;
+	get_bind_info = MySQLGetBindInfo;
+	projection_pushdown = true;
 }
 
 } // namespace duckdb
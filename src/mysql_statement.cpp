@@ -0,0 +1,361 @@
+#include "mysql_statement.hpp"
+#include "mysql_decoder.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/decimal.hpp"
+
+namespace duckdb {
+
+static constexpr const idx_t MYSQL_INITIAL_STRING_BUFFER_SIZE = 256;
+
+MySQLStatement::MySQLStatement(shared_ptr<OwnedMySQLConnection> connection_p, MYSQL_STMT *stmt, string query_p)
+    : connection(std::move(connection_p)), stmt(stmt), query(std::move(query_p)) {
+}
+
+MySQLStatement::~MySQLStatement() {
+	if (!stmt) {
+		return;
+	}
+	if (streaming && !exhausted && connection) {
+		// closing a partially read streaming statement would fetch (and discard) all remaining rows
+		// close the connection instead, which cancels the fetch
+		connection->Close();
+	}
+	if (cache_size > 0 && executed && connection && connection->connection) {
+		// keep the statement prepared for the next query with the same text
+		mysql_stmt_free_result(stmt);
+		connection->statement_cache.Return(query, stmt, cache_size);
+		return;
+	}
+	mysql_stmt_close(stmt);
+}
+
+void MySQLStatement::BindParameters(const vector<Value> &parameters) {
+	auto param_count = mysql_stmt_param_count(stmt);
+	if (param_count != parameters.size()) {
+		throw InternalException("MySQLStatement::BindParameters - expected %llu parameters but got %llu",
+		                        idx_t(param_count), parameters.size());
+	}
+	if (parameters.empty()) {
+		return;
+	}
+	// the parameter values are sent when the statement is executed - so they only have to outlive the execution
+	param_binds.resize(parameters.size());
+	param_values.resize(parameters.size());
+	memset(param_binds.data(), 0, sizeof(MYSQL_BIND) * param_binds.size());
+	for (idx_t p = 0; p < parameters.size(); p++) {
+		auto &parameter = parameters[p];
+		auto &value = param_values[p];
+		auto &bind = param_binds[p];
+		if (parameter.IsNull()) {
+			bind.buffer_type = MYSQL_TYPE_NULL;
+			continue;
+		}
+		// values are sent as they would be written as literals by MySQLFilterPushdown::TransformConstant
+		switch (parameter.type().id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::BIGINT:
+			value.int_value = parameter.GetValue<int64_t>();
+			bind.buffer_type = MYSQL_TYPE_LONGLONG;
+			bind.buffer = &value.int_value;
+			break;
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+		case LogicalTypeId::UBIGINT:
+			value.int_value = int64_t(parameter.GetValue<uint64_t>());
+			bind.buffer_type = MYSQL_TYPE_LONGLONG;
+			bind.buffer = &value.int_value;
+			bind.is_unsigned = true;
+			break;
+		case LogicalTypeId::FLOAT:
+		case LogicalTypeId::DOUBLE:
+			value.double_value = parameter.GetValue<double>();
+			bind.buffer_type = MYSQL_TYPE_DOUBLE;
+			bind.buffer = &value.double_value;
+			break;
+		case LogicalTypeId::DECIMAL:
+		case LogicalTypeId::HUGEINT:
+		case LogicalTypeId::UHUGEINT:
+			value.string_value = parameter.ToString();
+			bind.buffer_type = MYSQL_TYPE_NEWDECIMAL;
+			break;
+		case LogicalTypeId::BLOB:
+			value.string_value = StringValue::Get(parameter);
+			bind.buffer_type = MYSQL_TYPE_BLOB;
+			break;
+		case LogicalTypeId::TIMESTAMP_TZ:
+			value.string_value = parameter.DefaultCastAs(LogicalType::TIMESTAMP).ToString();
+			bind.buffer_type = MYSQL_TYPE_STRING;
+			break;
+		default:
+			value.string_value = parameter.ToString();
+			bind.buffer_type = MYSQL_TYPE_STRING;
+			break;
+		}
+		if (!bind.buffer) {
+			bind.buffer = (void *)value.string_value.data();
+			bind.buffer_length = value.string_value.size();
+		}
+	}
+	if (mysql_stmt_bind_param(stmt, param_binds.data()) != 0) {
+		throw IOException("Failed to bind parameters for query \"%s\": %s\n", query.c_str(), mysql_stmt_error(stmt));
+	}
+}
+
+void MySQLStatement::BindColumn(idx_t col_idx, MYSQL_FIELD *field) {
+	auto &col = columns[col_idx];
+	auto &bind = binds[col_idx];
+	bind.is_null = &col.is_null;
+	bind.error = &col.error;
+	bind.length = &col.length;
+	switch (col.type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		bind.buffer_type = MYSQL_TYPE_LONGLONG;
+		bind.buffer = &col.int_value;
+		break;
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+		bind.buffer_type = MYSQL_TYPE_LONGLONG;
+		bind.buffer = &col.int_value;
+		bind.is_unsigned = true;
+		break;
+	case LogicalTypeId::FLOAT:
+		bind.buffer_type = MYSQL_TYPE_FLOAT;
+		bind.buffer = &col.float_value;
+		break;
+	case LogicalTypeId::DOUBLE:
+		bind.buffer_type = MYSQL_TYPE_DOUBLE;
+		bind.buffer = &col.double_value;
+		break;
+	case LogicalTypeId::DATE:
+		bind.buffer_type = MYSQL_TYPE_DATE;
+		bind.buffer = &col.time_value;
+		break;
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		bind.buffer_type = MYSQL_TYPE_DATETIME;
+		bind.buffer = &col.time_value;
+		break;
+	default: {
+		// decimals are sent as text over the binary protocol as well
+		// booleans are read as text as they can be either numbers or bits
+		auto buffer_size = MinValue<idx_t>(field->length, MYSQL_INITIAL_STRING_BUFFER_SIZE);
+		col.string_buffer.resize(MaxValue<idx_t>(buffer_size, 1));
+		bind.buffer_type = MYSQL_TYPE_STRING;
+		bind.buffer = col.string_buffer.data();
+		bind.buffer_length = col.string_buffer.size();
+		break;
+	}
+	}
+}
+
+void MySQLStatement::Execute(const vector<LogicalType> &types, bool streaming_p, const vector<Value> &parameters) {
+	streaming = streaming_p;
+	BindParameters(parameters);
+	if (mysql_stmt_execute(stmt) != 0) {
+		throw IOException("Failed to run query \"%s\": %s\n", query.c_str(), mysql_stmt_error(stmt));
+	}
+	auto field_count = mysql_stmt_field_count(stmt);
+	if (field_count != types.size()) {
+		throw InternalException("MySQLStatement::Execute - expected %llu columns but got %llu", types.size(),
+		                        field_count);
+	}
+	auto metadata = mysql_stmt_result_metadata(stmt);
+	if (!metadata) {
+		throw IOException("Failed to fetch result metadata for query \"%s\": %s\n", query.c_str(),
+		                  mysql_stmt_error(stmt));
+	}
+	columns.resize(field_count);
+	binds.resize(field_count);
+	memset(binds.data(), 0, sizeof(MYSQL_BIND) * binds.size());
+	for (idx_t c = 0; c < field_count; c++) {
+		columns[c].type = types[c];
+		BindColumn(c, mysql_fetch_field_direct(metadata, c));
+	}
+	mysql_free_result(metadata);
+	if (mysql_stmt_bind_result(stmt, binds.data()) != 0) {
+		throw IOException("Failed to bind result for query \"%s\": %s\n", query.c_str(), mysql_stmt_error(stmt));
+	}
+	if (!streaming && mysql_stmt_store_result(stmt) != 0) {
+		throw IOException("Failed to fetch result for query \"%s\": %s\n", query.c_str(), mysql_stmt_error(stmt));
+	}
+	executed = true;
+}
+
+void MySQLStatement::FetchString(idx_t col_idx) {
+	auto &col = columns[col_idx];
+	if (col.length <= col.string_buffer.size()) {
+		return;
+	}
+	// the value did not fit in the buffer - grow the buffer and fetch the remainder of the value
+	col.string_buffer.resize(NextPowerOfTwo(col.length));
+	auto &bind = binds[col_idx];
+	bind.buffer = col.string_buffer.data();
+	bind.buffer_length = col.string_buffer.size();
+	if (mysql_stmt_fetch_column(stmt, &bind, col_idx, 0) != 0) {
+		throw IOException("Failed to fetch column for query \"%s\": %s\n", query.c_str(), mysql_stmt_error(stmt));
+	}
+	// the result has to be re-bound to use the larger buffer for the next rows
+	rebind_required = true;
+}
+
+template <class T>
+static void WriteMySQLDecimal(const MySQLStatementColumn &col, Vector &result, idx_t row) {
+	T value;
+	if (!MySQLDecoder::TryParseDecimal<T>(col.string_buffer.data(), col.length, DecimalType::GetScale(col.type), value)) {
+		FlatVector::SetNull(result, row, true);
+		return;
+	}
+	FlatVector::GetData<T>(result)[row] = value;
+}
+
+static bool MySQLTimeIsValid(const MYSQL_TIME &time) {
+	// MySQL allows "zero" dates (e.g. 0000-00-00) which we cannot represent
+	return Date::IsValid(int32_t(time.year), int32_t(time.month), int32_t(time.day));
+}
+
+void MySQLStatement::WriteValue(idx_t col_idx, Vector &result, idx_t row) {
+	auto &col = columns[col_idx];
+	if (col.is_null) {
+		FlatVector::SetNull(result, row, true);
+		return;
+	}
+	switch (col.type.id()) {
+	case LogicalTypeId::TINYINT:
+		FlatVector::GetData<int8_t>(result)[row] = int8_t(col.int_value);
+		break;
+	case LogicalTypeId::SMALLINT:
+		FlatVector::GetData<int16_t>(result)[row] = int16_t(col.int_value);
+		break;
+	case LogicalTypeId::INTEGER:
+		FlatVector::GetData<int32_t>(result)[row] = int32_t(col.int_value);
+		break;
+	case LogicalTypeId::BIGINT:
+		FlatVector::GetData<int64_t>(result)[row] = col.int_value;
+		break;
+	case LogicalTypeId::UTINYINT:
+		FlatVector::GetData<uint8_t>(result)[row] = uint8_t(col.int_value);
+		break;
+	case LogicalTypeId::USMALLINT:
+		FlatVector::GetData<uint16_t>(result)[row] = uint16_t(col.int_value);
+		break;
+	case LogicalTypeId::UINTEGER:
+		FlatVector::GetData<uint32_t>(result)[row] = uint32_t(col.int_value);
+		break;
+	case LogicalTypeId::UBIGINT:
+		FlatVector::GetData<uint64_t>(result)[row] = uint64_t(col.int_value);
+		break;
+	case LogicalTypeId::FLOAT:
+		FlatVector::GetData<float>(result)[row] = col.float_value;
+		break;
+	case LogicalTypeId::DOUBLE:
+		FlatVector::GetData<double>(result)[row] = col.double_value;
+		break;
+	case LogicalTypeId::DATE: {
+		auto &time = col.time_value;
+		if (!MySQLTimeIsValid(time)) {
+			FlatVector::SetNull(result, row, true);
+			break;
+		}
+		FlatVector::GetData<date_t>(result)[row] =
+		    Date::FromDate(int32_t(time.year), int32_t(time.month), int32_t(time.day));
+		break;
+	}
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ: {
+		auto &time = col.time_value;
+		if (!MySQLTimeIsValid(time)) {
+			FlatVector::SetNull(result, row, true);
+			break;
+		}
+		auto date = Date::FromDate(int32_t(time.year), int32_t(time.month), int32_t(time.day));
+		auto time_of_day =
+		    Time::FromTime(int32_t(time.hour), int32_t(time.minute), int32_t(time.second), int32_t(time.second_part));
+		FlatVector::GetData<timestamp_t>(result)[row] = Timestamp::FromDatetime(date, time_of_day);
+		break;
+	}
+	case LogicalTypeId::BOOLEAN: {
+		FetchString(col_idx);
+		if (col.length == 0) {
+			throw BinderException(
+			    "Failed to cast MySQL boolean - expected 1 byte element but got element of size %d\n* SET "
+			    "mysql_tinyint1_as_boolean=false to disable loading TINYINT(1) columns as booleans\n* SET "
+			    "mysql_bit1_as_boolean=false to disable loading BIT(1) columns as booleans",
+			    col.length);
+		}
+		// booleans are EITHER binary "1" or "0" (BIT(1)) OR a number - see DecodeBoolean in mysql_decoder.cpp
+		auto first_char = col.string_buffer[0];
+		FlatVector::GetData<bool>(result)[row] = !(first_char == '\0' || first_char == '0' || first_char == '-');
+		break;
+	}
+	case LogicalTypeId::DECIMAL:
+		FetchString(col_idx);
+		switch (col.type.InternalType()) {
+		case PhysicalType::INT16:
+			WriteMySQLDecimal<int16_t>(col, result, row);
+			break;
+		case PhysicalType::INT32:
+			WriteMySQLDecimal<int32_t>(col, result, row);
+			break;
+		case PhysicalType::INT64:
+			WriteMySQLDecimal<int64_t>(col, result, row);
+			break;
+		case PhysicalType::INT128:
+			WriteMySQLDecimal<hugeint_t>(col, result, row);
+			break;
+		default:
+			throw InternalException("Unsupported decimal storage type");
+		}
+		break;
+	default: {
+		FetchString(col_idx);
+		auto string_data = FlatVector::GetData<string_t>(result);
+		string_data[row] = StringVector::AddStringOrBlob(result, string_t(col.string_buffer.data(), col.length));
+		break;
+	}
+	}
+}
+
+idx_t MySQLStatement::Fetch(DataChunk &output) {
+	D_ASSERT(output.ColumnCount() == columns.size());
+	idx_t r;
+	for (r = 0; r < STANDARD_VECTOR_SIZE; r++) {
+		if (exhausted) {
+			break;
+		}
+		auto rc = mysql_stmt_fetch(stmt);
+		if (rc == MYSQL_NO_DATA) {
+			exhausted = true;
+			break;
+		}
+		if (rc == 1) {
+			throw IOException("Failed to fetch row for query \"%s\": %s\n", query.c_str(), mysql_stmt_error(stmt));
+		}
+		// rc is either 0 or MYSQL_DATA_TRUNCATED - truncated strings are fetched in WriteValue
+		for (idx_t c = 0; c < columns.size(); c++) {
+			WriteValue(c, output.data[c], r);
+			if (!columns[c].is_null) {
+				bytes_fetched += columns[c].length;
+			}
+		}
+		if (rebind_required) {
+			rebind_required = false;
+			if (mysql_stmt_bind_result(stmt, binds.data()) != 0) {
+				throw IOException("Failed to bind result for query \"%s\": %s\n", query.c_str(),
+				                  mysql_stmt_error(stmt));
+			}
+		}
+	}
+	return r;
+}
+
+} // namespace duckdb
@@ -0,0 +1,52 @@
+#include "mysql_statement_cache.hpp"
+
+namespace duckdb {
+
+MySQLStatementCache::~MySQLStatementCache() {
+	Clear();
+}
+
+MYSQL_STMT *MySQLStatementCache::Take(const string &query) {
+	lock_guard<mutex> l(lock);
+	auto entry = statement_map.find(query);
+	if (entry == statement_map.end()) {
+		return nullptr;
+	}
+	auto stmt = entry->second->second;
+	statements.erase(entry->second);
+	statement_map.erase(entry);
+	return stmt;
+}
+
+void MySQLStatementCache::Return(const string &query, MYSQL_STMT *stmt, idx_t capacity) {
+	lock_guard<mutex> l(lock);
+	if (capacity == 0 || statement_map.find(query) != statement_map.end()) {
+		// the same query was prepared by another scan while this statement was in use
+		mysql_stmt_close(stmt);
+		return;
+	}
+	statements.emplace_front(query, stmt);
+	statement_map[query] = statements.begin();
+	while (statements.size() > capacity) {
+		auto &evicted = statements.back();
+		mysql_stmt_close(evicted.second);
+		statement_map.erase(evicted.first);
+		statements.pop_back();
+	}
+}
+
+void MySQLStatementCache::Clear() {
+	lock_guard<mutex> l(lock);
+	for (auto &entry : statements) {
+		mysql_stmt_close(entry.second);
+	}
+	statements.clear();
+	statement_map.clear();
+}
+
+idx_t MySQLStatementCache::Count() {
+	lock_guard<mutex> l(lock);
+	return statements.size();
+}
+
+} // namespace duckdb
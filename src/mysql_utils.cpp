@@ -1,5 +1,7 @@
 #include "mysql_utils.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "mysql_escape.hpp"
 #include "mysql_com.h"
 #include "storage/mysql_schema_entry.hpp"
 #include "storage/mysql_transaction.hpp"
@@ -177,11 +179,52 @@ MySQLConnectionParameters MySQLUtils::ParseConnectionParameters(const string &ds
 		} else if (key == "ssl_key") {
 			set_options.insert("ssl_key");
 			result.ssl_key = value;
+		} else if (key == "compression_algorithms") {
+			auto algorithms = StringUtil::Split(StringUtil::Lower(value), ',');
+			for (auto &algorithm : algorithms) {
+				StringUtil::Trim(algorithm);
+				if (algorithm != "zstd" && algorithm != "zlib" && algorithm != "uncompressed") {
+					throw InvalidInputException(
+					    "Invalid dsn - compression algorithms must be zstd, zlib or uncompressed - got %s", value);
+				}
+			}
+			result.compression_algorithms = StringUtil::Join(algorithms, ",");
+		} else if (key == "zstd_compression_level") {
+			int32_t level;
+			if (!TryCast::Operation<string_t, int32_t>(string_t(value), level, true) || level < 1 || level > 22) {
+				throw InvalidInputException("Invalid dsn - zstd compression level must be between 1 and 22 - got %s",
+				                            value);
+			}
+			result.zstd_compression_level = uint32_t(level);
+		} else if (key == "replicas") {
+			result.replicas.clear();
+			for (auto &replica : StringUtil::Split(value, ',')) {
+				StringUtil::Trim(replica);
+				if (!replica.empty()) {
+					result.replicas.push_back(replica);
+				}
+			}
+		} else if (key == "replica_policy") {
+			auto policy = StringUtil::Lower(value);
+			if (policy != "round_robin" && policy != "least_loaded") {
+				throw InvalidInputException("Invalid dsn - replica policy must be round_robin or least_loaded - got %s",
+				                            value);
+			}
+			result.replica_policy = policy;
+		} else if (key == "replica_max_lag") {
+			int64_t max_lag;
+			if (!TryCast::Operation<string_t, int64_t>(string_t(value), max_lag, true) || max_lag < 0) {
+				throw InvalidInputException("Invalid dsn - replica max lag must be a number of seconds - got %s",
+				                            value);
+			}
+			result.replica_max_lag = max_lag;
 		} else {
-			throw InvalidInputException("Unrecognized configuration parameter \"%s\" "
-			                            "- expected options are host, "
-			                            "user, passwd, db, port, socket",
-			                            key);
+			throw InvalidInputException(
+			    "Unrecognized configuration parameter \"%s\" - expected options are host, user, passwd (password), db "
+			    "(database), port, socket (unix_socket), compress, compression, compression_algorithms, "
+			    "zstd_compression_level, ssl_mode, ssl_ca, ssl_capath, ssl_cert, ssl_cipher, ssl_crl, ssl_crlpath, "
+			    "ssl_key, replicas, replica_policy and replica_max_lag",
+			    key);
 		}
 	}
 	// read options that are not set from environment variables
@@ -247,6 +290,20 @@ MYSQL *MySQLUtils::Connect(const string &dsn) {
 	SetMySQLOption(mysql, MYSQL_OPT_SSL_CRL, config.ssl_crl);
 	SetMySQLOption(mysql, MYSQL_OPT_SSL_CRLPATH, config.ssl_crl_path);
 	SetMySQLOption(mysql, MYSQL_OPT_SSL_KEY, config.ssl_key);
+	// set compression options (if any)
+	if (!config.compression_algorithms.empty()) {
+		// CLIENT_COMPRESS would request zlib regardless of the configured algorithms
+		config.client_flag &= ~CLIENT_COMPRESS;
+		SetMySQLOption(mysql, MYSQL_OPT_COMPRESSION_ALGORITHMS, config.compression_algorithms);
+	}
+	if (config.zstd_compression_level != 0) {
+		mysql_options(mysql, MYSQL_OPT_ZSTD_COMPRESSION_LEVEL, &config.zstd_compression_level);
+	}
+
+	// LOAD DATA LOCAL INFILE is only possible if CLIENT_LOCAL_FILES was announced in the handshake - it is enabled
+	// while connecting, and then only for the queries of MySQLConnection::LoadData
+	unsigned int local_infile = 1;
+	mysql_options(mysql, MYSQL_OPT_LOCAL_INFILE, &local_infile);
 
 	// get connection options
 	const char *host = config.host.empty() ? nullptr : config.host.c_str();
@@ -265,6 +322,8 @@ MYSQL *MySQLUtils::Connect(const string &dsn) {
 			throw IOException("Failed to connect to MySQL database with parameters \"%s\": %s", dsn, mysql_error(mysql));
 		}
 	}
+	local_infile = 0;
+	mysql_options(result, MYSQL_OPT_LOCAL_INFILE, &local_infile);
 	if (mysql_set_character_set(result, "utf8mb4") != 0) {
 		throw IOException("Failed to set MySQL character set");
 	}
@@ -383,7 +442,7 @@ LogicalType MySQLUtils::TypeToLogicalType(ClientContext &context, const MySQLTyp
 	return LogicalType::VARCHAR;
 }
 
-LogicalType MySQLUtils::FieldToLogicalType(ClientContext &context, MYSQL_FIELD *field) {
+LogicalType MySQLUtils::FieldToLogicalType(ClientContext &context, MYSQL_FIELD *field, bool streaming) {
 	MySQLTypeData type_data;
 	switch (field->type) {
 	case MYSQL_TYPE_TINY:
@@ -457,8 +516,10 @@ LogicalType MySQLUtils::FieldToLogicalType(ClientContext &context, MYSQL_FIELD *
 		break;
 	}
 	type_data.column_type = type_data.type_name;
-	if (field->max_length != 0) {
-		type_data.column_type += "(" + std::to_string(field->max_length) + ")";
+	// max_length is only computed for buffered results - for streaming results we use the declared length instead
+	auto length = streaming ? field->length : field->max_length;
+	if (length != 0) {
+		type_data.column_type += "(" + std::to_string(length) + ")";
 	}
 	if (field->flags & UNSIGNED_FLAG && field->flags & NUM_FLAG) {
 		type_data.column_type += " unsigned";
@@ -505,17 +566,9 @@ LogicalType MySQLUtils::ToMySQLType(const LogicalType &input) {
 }
 
 string MySQLUtils::EscapeQuotes(const string &text, char quote) {
-	string result;
-	for (auto c : text) {
-		if (c == quote) {
-			result += "\\";
-			result += quote;
-		} else if (c == '\\') {
-			result += "\\\\";
-		} else {
-			result += c;
-		}
-	}
+	// reserve space for the worst case (every character escaped) and write in-place
+	string result(text.size() * 2, '\0');
+	result.resize(MySQLEscape::EscapeQuoted(text.data(), text.size(), quote, &result[0]));
 	return result;
 }
 
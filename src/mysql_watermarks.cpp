@@ -0,0 +1,83 @@
+#include "duckdb.hpp"
+
+#include "mysql_scanner.hpp"
+#include "mysql_watermarks.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "storage/mysql_catalog.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Watermarks
+//===--------------------------------------------------------------------===//
+bool MySQLWatermarks::TryGet(const string &name, string &watermark) {
+	lock_guard<mutex> l(lock);
+	auto entry = watermarks.find(name);
+	if (entry == watermarks.end()) {
+		return false;
+	}
+	watermark = entry->second;
+	return true;
+}
+
+void MySQLWatermarks::Set(const string &name, string watermark) {
+	lock_guard<mutex> l(lock);
+	watermarks[name] = std::move(watermark);
+}
+
+map<string, string> MySQLWatermarks::GetAll() {
+	lock_guard<mutex> l(lock);
+	return watermarks;
+}
+
+//===--------------------------------------------------------------------===//
+// mysql_watermarks
+//===--------------------------------------------------------------------===//
+struct MySQLWatermarksFunctionData : public TableFunctionData {
+	//! The database name, watermark name and watermark of every recorded watermark
+	vector<vector<string>> entries;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> MySQLWatermarksBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("watermark");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	auto result = make_uniq<MySQLWatermarksFunctionData>();
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &db_ref : databases) {
+		auto &catalog = db_ref.get().GetCatalog();
+		if (catalog.GetCatalogType() != "mysql") {
+			continue;
+		}
+		for (auto &entry : catalog.Cast<MySQLCatalog>().GetWatermarks().GetAll()) {
+			result->entries.push_back({catalog.GetName(), entry.first, entry.second});
+		}
+	}
+	return std::move(result);
+}
+
+static void MySQLWatermarksExecute(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<MySQLWatermarksFunctionData>();
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		for (idx_t c = 0; c < entry.size(); c++) {
+			output.SetValue(c, count, Value(entry[c]));
+		}
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+MySQLWatermarksFunction::MySQLWatermarksFunction()
+    : TableFunction("mysql_watermarks", {}, MySQLWatermarksExecute, MySQLWatermarksBind) {
+}
+
+} // namespace duckdb
@@ -13,10 +13,13 @@ namespace duckdb {
 MySQLCatalog::MySQLCatalog(AttachedDatabase &db_p, string connection_string_p, string attach_path_p,
                            AccessMode access_mode)
     : Catalog(db_p), connection_string(std::move(connection_string_p)), attach_path(std::move(attach_path_p)),
-      access_mode(access_mode), schemas(*this) {
-	default_schema = MySQLUtils::ParseConnectionParameters(connection_string).db;
-	// try to connect
-	auto connection = MySQLConnection::Open(connection_string);
+      access_mode(access_mode), schema_cache_invalidated(false), schemas(*this) {
+	auto parameters = MySQLUtils::ParseConnectionParameters(connection_string);
+	default_schema = parameters.db;
+	connection_pool = make_shared_ptr<MySQLConnectionPool>(connection_string);
+	replica_router = make_uniq<MySQLReplicaRouter>(connection_string, parameters);
+	// try to connect - the connection is kept around for the first transaction
+	connection_pool->Release(MySQLConnection::Open(connection_string));
 }
 
 MySQLCatalog::~MySQLCatalog() = default;
@@ -215,6 +218,8 @@ void ParseAttributes(const vector<URIToken> &tokens, idx_t attribute_start, vect
 	unordered_map<string, string> uri_attribute_map;
 	uri_attribute_map["socket"] = "socket";
 	uri_attribute_map["compression"] = "compression";
+	uri_attribute_map["compression-algorithms"] = "compression_algorithms";
+	uri_attribute_map["zstd-compression-level"] = "zstd_compression_level";
 	uri_attribute_map["ssl-mode"] = "ssl_mode";
 	uri_attribute_map["ssl-ca"] = "ssl_ca";
 	uri_attribute_map["ssl-capath"] = "ssl_capath";
@@ -223,6 +228,9 @@ void ParseAttributes(const vector<URIToken> &tokens, idx_t attribute_start, vect
 	uri_attribute_map["ssl-crl"] = "ssl_crl";
 	uri_attribute_map["ssl-crlpath"] = "ssl_crlpath";
 	uri_attribute_map["ssl-key"] = "ssl_key";
+	uri_attribute_map["replicas"] = "replicas";
+	uri_attribute_map["replica-policy"] = "replica_policy";
+	uri_attribute_map["replica-max-lag"] = "replica_max_lag";
 
 	// parse key=value attributes
 	for(idx_t i = attribute_start; i < tokens.size(); i += 2) {
@@ -350,6 +358,12 @@ string MySQLCatalog::GetConnectionString(ClientContext &context, const string &a
 		new_connection_info += AddConnectionOption(kv_secret, "ssl_crl");
 		new_connection_info += AddConnectionOption(kv_secret, "ssl_crlpath");
 		new_connection_info += AddConnectionOption(kv_secret, "ssl_key");
+		new_connection_info += AddConnectionOption(kv_secret, "compression");
+		new_connection_info += AddConnectionOption(kv_secret, "compression_algorithms");
+		new_connection_info += AddConnectionOption(kv_secret, "zstd_compression_level");
+		new_connection_info += AddConnectionOption(kv_secret, "replicas");
+		new_connection_info += AddConnectionOption(kv_secret, "replica_policy");
+		new_connection_info += AddConnectionOption(kv_secret, "replica_max_lag");
 		connection_string = new_connection_info + connection_string;
 	} else if (explicit_secret) {
 		// secret not found and one was explicitly provided - throw an error
@@ -378,7 +392,56 @@ void MySQLCatalog::DropSchema(ClientContext &context, DropInfo &info) {
 }
 
 void MySQLCatalog::ScanSchemas(ClientContext &context, std::function<void(SchemaCatalogEntry &)> callback) {
-	schemas.Scan(context, [&](CatalogEntry &schema) { callback(schema.Cast<MySQLSchemaEntry>()); });
+	vector<reference<MySQLSchemaEntry>> schema_entries;
+	schemas.Scan(context, [&](CatalogEntry &schema) { schema_entries.push_back(schema.Cast<MySQLSchemaEntry>()); });
+	bool prefetch_armed = false;
+	for (idx_t i = 0; i < schema_entries.size(); i++) {
+		auto &schema = schema_entries[i].get();
+		auto tables_were_loaded = schema.TablesAreLoaded();
+		callback(schema);
+		if (prefetch_armed || tables_were_loaded || !schema.TablesAreLoaded()) {
+			continue;
+		}
+		// the callback has loaded the tables of the schema - which usually means all tables are listed (e.g. by
+		// duckdb_tables()). Instead of querying information_schema once per schema, the columns of the remaining
+		// schemas are loaded in one query when the tables of the next schema are loaded. Scans that only bind names
+		// do not load any tables, and so do not load the columns of every schema.
+		vector<string> unloaded_schemas;
+		for (idx_t next = i + 1; next < schema_entries.size(); next++) {
+			if (!schema_entries[next].get().TablesAreLoaded()) {
+				unloaded_schemas.push_back(schema_entries[next].get().name);
+			}
+		}
+		if (unloaded_schemas.size() > 1) {
+			lock_guard<mutex> l(prefetch_lock);
+			prefetch_schemas = std::move(unloaded_schemas);
+		}
+		prefetch_armed = true;
+	}
+	if (prefetch_armed) {
+		// columns that were prefetched for schemas the callback did not load are not kept - they could be outdated
+		// by the time the schema is loaded
+		lock_guard<mutex> l(prefetch_lock);
+		prefetch_schemas.clear();
+		prefetched_columns.clear();
+	}
+}
+
+bool MySQLCatalog::TryGetPrefetchedColumns(ClientContext &context, const string &schema_name,
+                                           vector<MySQLColumnInfo> &columns) {
+	lock_guard<mutex> l(prefetch_lock);
+	if (std::find(prefetch_schemas.begin(), prefetch_schemas.end(), schema_name) != prefetch_schemas.end()) {
+		auto schema_names = std::move(prefetch_schemas);
+		prefetch_schemas.clear();
+		prefetched_columns = MySQLTableSet::LoadColumns(context, *this, schema_names);
+	}
+	auto entry = prefetched_columns.find(schema_name);
+	if (entry == prefetched_columns.end()) {
+		return false;
+	}
+	columns = std::move(entry->second);
+	prefetched_columns.erase(entry);
+	return true;
 }
 
 optional_ptr<SchemaCatalogEntry> MySQLCatalog::GetSchema(CatalogTransaction transaction, const string &schema_name,
@@ -433,7 +496,42 @@ WHERE table_schema = ${SCHEMA_NAME};
 }
 
 void MySQLCatalog::ClearCache() {
+	schema_cache_invalidated = true;
 	schemas.ClearEntries();
+	result_cache.Clear();
+	cached_tables.InvalidateAll();
+	lock_guard<mutex> l(prefetch_lock);
+	prefetch_schemas.clear();
+	prefetched_columns.clear();
+}
+
+void MySQLCatalog::ClearCache(const string &schema_name, const string &table_name) {
+	{
+		lock_guard<mutex> l(invalidated_schemas_lock);
+		invalidated_schemas.insert(schema_name);
+	}
+	result_cache.Clear();
+	cached_tables.InvalidateAll();
+	if (table_name.empty()) {
+		{
+			lock_guard<mutex> l(prefetch_lock);
+			prefetched_columns.erase(schema_name);
+		}
+		schemas.InvalidateEntry(schema_name);
+		return;
+	}
+	auto schema = schemas.GetLoadedEntry(schema_name);
+	if (schema) {
+		schema->Cast<MySQLSchemaEntry>().InvalidateTable(table_name);
+	}
+}
+
+bool MySQLCatalog::SchemaCacheInvalidated(const string &schema_name) {
+	if (schema_cache_invalidated) {
+		return true;
+	}
+	lock_guard<mutex> l(invalidated_schemas_lock);
+	return invalidated_schemas.find(schema_name) != invalidated_schemas.end();
 }
 
 } // namespace duckdb
@@ -2,25 +2,114 @@
 #include "storage/mysql_transaction.hpp"
 #include "duckdb/parser/parsed_data/drop_info.hpp"
 #include "storage/mysql_schema_entry.hpp"
+#include "storage/mysql_catalog.hpp"
 
 namespace duckdb {
 
 MySQLCatalogSet::MySQLCatalogSet(Catalog &catalog) : catalog(catalog), is_loaded(false) {
 }
 
+static bool UseLazyLoading(ClientContext &context) {
+	Value lazy_loading;
+	if (!context.TryGetCurrentSetting("mysql_lazy_schema_loading", lazy_loading)) {
+		return false;
+	}
+	return BooleanValue::Get(lazy_loading);
+}
+
+MySQLCatalogSet::MySQLCatalogSetShard &MySQLCatalogSet::GetShard(const string &name) {
+	return shards[StringUtil::CIHash(name) % SHARD_COUNT];
+}
+
+void MySQLCatalogSet::EnsureLoaded(ClientContext &context) {
+	if (is_loaded) {
+		return;
+	}
+	// only one thread loads the entries - the others wait for it here, instead of seeing a partially loaded set
+	lock_guard<mutex> l(load_lock);
+	if (is_loaded) {
+		return;
+	}
+	LoadEntries(context);
+	is_loaded = true;
+}
+
+optional_ptr<CatalogEntry> MySQLCatalogSet::GetEntryLazy(ClientContext &context, const string &name) {
+	auto &shard = GetShard(name);
+	{
+		unique_lock<mutex> l(shard.lock);
+		while (true) {
+			auto entry = shard.entries.find(name);
+			if (entry != shard.entries.end()) {
+				return entry->second.get();
+			}
+			if (shard.missing_entries.find(name) != shard.missing_entries.end()) {
+				return nullptr;
+			}
+			if (shard.loading_entries.find(name) == shard.loading_entries.end()) {
+				break;
+			}
+			// another thread is loading this entry - wait for it instead of loading it again
+			shard.load_finished.wait(l);
+		}
+		shard.loading_entries.insert(name);
+	}
+	optional_ptr<CatalogEntry> result;
+	try {
+		result = LoadEntry(context, name);
+	} catch (...) {
+		lock_guard<mutex> l(shard.lock);
+		shard.loading_entries.erase(name);
+		shard.load_finished.notify_all();
+		throw;
+	}
+	lock_guard<mutex> l(shard.lock);
+	if (!result) {
+		shard.missing_entries.insert(name);
+	}
+	shard.invalidated_entries.erase(name);
+	shard.loading_entries.erase(name);
+	shard.load_finished.notify_all();
+	return result;
+}
+
 optional_ptr<CatalogEntry> MySQLCatalogSet::GetEntry(ClientContext &context, const string &name) {
 	if (!is_loaded) {
-		is_loaded = true;
-		LoadEntries(context);
+		if (SupportsLazyLoading() && UseLazyLoading(context)) {
+			// only load the requested entry
+			return GetEntryLazy(context, name);
+		}
+		EnsureLoaded(context);
+	}
+	auto &shard = GetShard(name);
+	{
+		lock_guard<mutex> l(shard.lock);
+		auto entry = shard.entries.find(name);
+		if (entry != shard.entries.end()) {
+			return entry->second.get();
+		}
+		if (shard.invalidated_entries.find(name) == shard.invalidated_entries.end()) {
+			return nullptr;
+		}
 	}
-	lock_guard<mutex> l(entry_lock);
-	auto entry = entries.find(name);
-	if (entry == entries.end()) {
+	// the entry was invalidated - reload only this entry
+	return GetEntryLazy(context, name);
+}
+
+optional_ptr<CatalogEntry> MySQLCatalogSet::GetLoadedEntry(const string &name) {
+	auto &shard = GetShard(name);
+	lock_guard<mutex> l(shard.lock);
+	auto entry = shard.entries.find(name);
+	if (entry == shard.entries.end()) {
 		return nullptr;
 	}
 	return entry->second.get();
 }
 
+optional_ptr<CatalogEntry> MySQLCatalogSet::LoadEntry(ClientContext &context, const string &name) {
+	throw InternalException("MySQLCatalogSet::LoadEntry not supported for this catalog set");
+}
+
 void MySQLCatalogSet::DropEntry(ClientContext &context, DropInfo &info) {
 	string drop_query = "DROP ";
 	drop_query += CatalogTypeToString(info.type) + " ";
@@ -35,42 +124,89 @@ void MySQLCatalogSet::DropEntry(ClientContext &context, DropInfo &info) {
 	}
 	auto &transaction = MySQLTransaction::Get(context, catalog);
 	transaction.Query(drop_query);
+	catalog.Cast<MySQLCatalog>().GetResultCache().Clear();
+	catalog.Cast<MySQLCatalog>().GetCachedTables().InvalidateAll();
 
 	// erase the entry from the catalog set
 	EraseEntryInternal(info.name);
 }
 
 void MySQLCatalogSet::EraseEntryInternal(const string &name) {
-	lock_guard<mutex> l(entry_lock);
-	entries.erase(name);
+	auto &shard = GetShard(name);
+	lock_guard<mutex> l(shard.lock);
+	shard.entries.erase(name);
 }
 
 void MySQLCatalogSet::Scan(ClientContext &context, const std::function<void(CatalogEntry &)> &callback) {
-	if (!is_loaded) {
-		is_loaded = true;
-		LoadEntries(context);
+	EnsureLoaded(context);
+	// reload any entries that were invalidated since the set was loaded
+	for (auto &shard : shards) {
+		vector<string> invalidated_entries;
+		{
+			lock_guard<mutex> l(shard.lock);
+			invalidated_entries.insert(invalidated_entries.end(), shard.invalidated_entries.begin(),
+			                           shard.invalidated_entries.end());
+		}
+		for (auto &name : invalidated_entries) {
+			GetEntryLazy(context, name);
+		}
 	}
-	lock_guard<mutex> l(entry_lock);
-	for (auto &entry : entries) {
-		callback(*entry.second);
+	for (auto &shard : shards) {
+		lock_guard<mutex> l(shard.lock);
+		for (auto &entry : shard.entries) {
+			callback(*entry.second);
+		}
+	}
+}
+
+void MySQLCatalogSet::ScanLoadedEntries(const std::function<void(CatalogEntry &)> &callback) {
+	for (auto &shard : shards) {
+		lock_guard<mutex> l(shard.lock);
+		for (auto &entry : shard.entries) {
+			callback(*entry.second);
+		}
 	}
 }
 
 optional_ptr<CatalogEntry> MySQLCatalogSet::CreateEntry(unique_ptr<CatalogEntry> entry) {
-	lock_guard<mutex> l(entry_lock);
-	auto result = entry.get();
-	if (result->name.empty()) {
+	if (entry->name.empty()) {
 		throw InternalException("MySQLCatalogSet::CreateEntry called with empty name");
 	}
-	entries.insert(make_pair(result->name, std::move(entry)));
-	return result;
+	auto &shard = GetShard(entry->name);
+	lock_guard<mutex> l(shard.lock);
+	shard.missing_entries.erase(entry->name);
+	shard.invalidated_entries.erase(entry->name);
+	// if the entry already exists (e.g. because it was loaded concurrently) the existing entry is kept
+	auto result = shard.entries.insert(make_pair(entry->name, std::move(entry)));
+	return result.first->second.get();
 }
 
 void MySQLCatalogSet::ClearEntries() {
-	entries.clear();
+	lock_guard<mutex> load_guard(load_lock);
+	for (auto &shard : shards) {
+		lock_guard<mutex> l(shard.lock);
+		shard.entries.clear();
+		shard.missing_entries.clear();
+		shard.invalidated_entries.clear();
+	}
 	is_loaded = false;
 }
 
+void MySQLCatalogSet::InvalidateEntry(const string &name) {
+	if (!SupportsLoadingEntries()) {
+		ClearEntries();
+		return;
+	}
+	auto &shard = GetShard(name);
+	lock_guard<mutex> l(shard.lock);
+	shard.entries.erase(name);
+	shard.missing_entries.erase(name);
+	if (is_loaded) {
+		// the set is not loaded again - remember to load this entry by itself
+		shard.invalidated_entries.insert(name);
+	}
+}
+
 MySQLInSchemaSet::MySQLInSchemaSet(MySQLSchemaEntry &schema) : MySQLCatalogSet(schema.ParentCatalog()), schema(schema) {
 }
 
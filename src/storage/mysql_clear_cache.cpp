@@ -10,12 +10,36 @@ namespace duckdb {
 
 struct ClearCacheFunctionData : public TableFunctionData {
 	bool finished = false;
+	//! Set if only the cache of a database, schema or table is cleared (mysql_clear_cache('db[.schema[.table]]'))
+	string database_name;
+	string schema_name;
+	string table_name;
 };
 
 static unique_ptr<FunctionData> ClearCacheBind(ClientContext &context, TableFunctionBindInput &input,
                                                vector<LogicalType> &return_types, vector<string> &names) {
 
 	auto result = make_uniq<ClearCacheFunctionData>();
+	if (!input.inputs.empty()) {
+		if (input.inputs[0].IsNull()) {
+			throw BinderException("mysql_clear_cache: the target cannot be NULL");
+		}
+		auto target = input.inputs[0].GetValue<string>();
+		auto parts = StringUtil::Split(target, '.');
+		if (parts.empty() || parts.size() > 3) {
+			throw BinderException("mysql_clear_cache: expected a target of the form \"database[.schema[.table]]\" "
+			                      "- got \"%s\"",
+			                      target);
+		}
+		result->database_name = parts[0];
+		result->schema_name = parts.size() > 1 ? parts[1] : string();
+		result->table_name = parts.size() > 2 ? parts[2] : string();
+		auto db = DatabaseManager::Get(context).GetDatabase(context, result->database_name);
+		if (!db || db->GetCatalog().GetCatalogType() != "mysql") {
+			throw BinderException("mysql_clear_cache: \"%s\" is not an attached MySQL database",
+			                      result->database_name);
+		}
+	}
 	return_types.push_back(LogicalType::BOOLEAN);
 	names.emplace_back("Success");
 	return std::move(result);
@@ -38,8 +62,21 @@ static void ClearCacheFunction(ClientContext &context, TableFunctionInput &data_
 	if (data.finished) {
 		return;
 	}
-	ClearMySQLCaches(context);
 	data.finished = true;
+	if (data.database_name.empty()) {
+		ClearMySQLCaches(context);
+		return;
+	}
+	auto db = DatabaseManager::Get(context).GetDatabase(context, data.database_name);
+	if (!db) {
+		throw BinderException("mysql_clear_cache: database \"%s\" is no longer attached", data.database_name);
+	}
+	auto &catalog = db->GetCatalog().Cast<MySQLCatalog>();
+	if (data.schema_name.empty()) {
+		catalog.ClearCache();
+	} else {
+		catalog.ClearCache(data.schema_name, data.table_name);
+	}
 }
 
 void MySQLClearCacheFunction::ClearCacheOnSetting(ClientContext &context, SetScope scope, Value &parameter) {
@@ -49,4 +86,12 @@ void MySQLClearCacheFunction::ClearCacheOnSetting(ClientContext &context, SetSco
 MySQLClearCacheFunction::MySQLClearCacheFunction()
     : TableFunction("mysql_clear_cache", {}, ClearCacheFunction, ClearCacheBind) {
 }
+
+TableFunctionSet MySQLClearCacheFunction::GetFunctionSet() {
+	TableFunctionSet result("mysql_clear_cache");
+	result.AddFunction(MySQLClearCacheFunction());
+	TableFunction targeted("mysql_clear_cache", {LogicalType::VARCHAR}, ClearCacheFunction, ClearCacheBind);
+	result.AddFunction(std::move(targeted));
+	return result;
+}
 } // namespace duckdb
@@ -0,0 +1,265 @@
+#include "mysql_scanner.hpp"
+#include "mysql_scan_stats.hpp"
+#include "storage/mysql_catalog.hpp"
+#include "storage/mysql_insert_buffer.hpp"
+#include "storage/mysql_table_entry.hpp"
+#include "storage/mysql_transaction.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/chrono.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Bind
+//===--------------------------------------------------------------------===//
+struct MySQLCopyBindData : public FunctionData {
+	string database_name;
+	string schema_name;
+	string table_name;
+	//! The columns of the table the copied columns are loaded into - empty if they are loaded by position
+	vector<string> column_names;
+	//! The types of the copied columns
+	vector<LogicalType> column_types;
+	//! Whether the rows are loaded into a staging table that replaces the table once all rows are loaded
+	bool swap = false;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<MySQLCopyBindData>(*this);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<MySQLCopyBindData>();
+		return database_name == other.database_name && schema_name == other.schema_name &&
+		       table_name == other.table_name && column_names == other.column_names &&
+		       column_types == other.column_types && swap == other.swap;
+	}
+};
+
+static unique_ptr<FunctionData> MySQLCopyBind(ClientContext &context, CopyFunctionBindInput &input,
+                                              const vector<string> &names, const vector<LogicalType> &sql_types) {
+	auto result = make_uniq<MySQLCopyBindData>();
+	for (auto &option : input.info.options) {
+		auto loption = StringUtil::Lower(option.first);
+		if (loption == "swap") {
+			result->swap =
+			    option.second.empty() || BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else {
+			throw BinderException("Unrecognized option for COPY TO MySQL \"%s\"", option.first);
+		}
+	}
+	auto &target = input.info.file_path;
+	auto parts = StringUtil::Split(target, '.');
+	if (parts.size() < 2 || parts.size() > 3) {
+		throw BinderException("COPY TO MySQL: expected a target of the form \"database[.schema].table\" - got \"%s\"",
+		                      target);
+	}
+	auto db = DatabaseManager::Get(context).GetDatabase(context, parts[0]);
+	if (!db || db->GetCatalog().GetCatalogType() != "mysql") {
+		throw BinderException("COPY TO MySQL: \"%s\" is not an attached MySQL database", parts[0]);
+	}
+	auto &catalog = db->GetCatalog().Cast<MySQLCatalog>();
+	if (catalog.access_mode == AccessMode::READ_ONLY) {
+		throw BinderException("COPY TO MySQL: cannot copy into \"%s\" - the database is attached in read-only mode",
+		                      parts[0]);
+	}
+	// the rows are loaded (and committed) over separate connections - this may not happen behind the back of an
+	// explicit transaction
+	if (!MySQLTransaction::CanUseSeparateConnection(context, catalog)) {
+		throw BinderException("COPY TO MySQL can only be used in auto-commit mode - use INSERT INTO to insert data "
+		                      "within a transaction");
+	}
+	auto schema_name = parts.size() == 3 ? parts[1] : string(DEFAULT_SCHEMA);
+	auto &table = catalog.GetEntry<TableCatalogEntry>(context, schema_name, parts.back()).Cast<MySQLTableEntry>();
+	for (auto &type : sql_types) {
+		// throws for types that cannot be stored in MySQL
+		MySQLUtils::ToMySQLType(type);
+	}
+	// columns are matched by name if all of them are columns of the table - otherwise by position
+	auto &columns = table.GetColumns();
+	bool match_by_name = true;
+	for (auto &name : names) {
+		if (!columns.ColumnExists(name)) {
+			match_by_name = false;
+			break;
+		}
+	}
+	if (match_by_name) {
+		for (auto &name : names) {
+			result->column_names.push_back(columns.GetColumn(name).GetName());
+		}
+	} else if (names.size() != columns.LogicalColumnCount()) {
+		throw BinderException("COPY TO MySQL: table \"%s\" has %llu columns but %llu columns were supplied - to load "
+		                      "a subset of the columns, name the supplied columns after the columns of the table",
+		                      table.name, columns.LogicalColumnCount(), names.size());
+	}
+	result->database_name = parts[0];
+	result->schema_name = table.schema.name;
+	result->table_name = table.name;
+	result->column_types = sql_types;
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// States
+//===--------------------------------------------------------------------===//
+class MySQLCopyGlobalState : public GlobalFunctionData {
+public:
+	explicit MySQLCopyGlobalState(MySQLCatalog &catalog)
+	    : catalog(catalog), connection_pool(catalog.GetConnectionPoolPtr()) {
+	}
+	~MySQLCopyGlobalState() override {
+		catalog.GetStatsLog().Record(stats);
+		if (staging_table.empty()) {
+			return;
+		}
+		// the copy failed before the staging table replaced the target table - try to drop it
+		try {
+			auto con = connection_pool->Acquire();
+			con.Execute("DROP TABLE IF EXISTS " + staging_table);
+			connection_pool->Release(std::move(con));
+		} catch (...) {
+		}
+	}
+
+	MySQLCatalog &catalog;
+	shared_ptr<MySQLConnectionPool> connection_pool;
+	MySQLInsertOptions options;
+	//! The (qualified) name of the table that is copied into
+	string table_name;
+	//! The (qualified) name of the staging table that replaces the table once all rows are loaded (swap only)
+	string staging_table;
+	//! The per-thread connections with uncommitted loads (without swap only)
+	vector<MySQLConnection> connections;
+	mutex lock;
+	MySQLOperatorStats stats;
+};
+
+class MySQLCopyLocalState : public LocalFunctionData {
+public:
+	MySQLConnection connection;
+	//! Created on the first chunk - the local state is initialized without access to the global state
+	unique_ptr<MySQLInsertBuffer> buffer;
+};
+
+static unique_ptr<GlobalFunctionData> MySQLCopyInitializeGlobal(ClientContext &context, FunctionData &bind_data_p,
+                                                                const string &file_path) {
+	auto &bind_data = bind_data_p.Cast<MySQLCopyBindData>();
+	auto db = DatabaseManager::Get(context).GetDatabase(context, bind_data.database_name);
+	if (!db) {
+		throw BinderException("COPY TO MySQL: database \"%s\" is no longer attached", bind_data.database_name);
+	}
+	auto &catalog = db->GetCatalog().Cast<MySQLCatalog>();
+	auto result = make_uniq<MySQLCopyGlobalState>(catalog);
+	result->stats.database_name = catalog.GetName();
+	result->stats.operator_name = "copy";
+	result->stats.target = bind_data.table_name;
+	result->table_name =
+	    MySQLUtils::WriteIdentifier(bind_data.schema_name) + "." + MySQLUtils::WriteIdentifier(bind_data.table_name);
+	auto target_name = result->table_name;
+	if (bind_data.swap) {
+		auto uuid = StringUtil::Replace(UUID::ToString(UUID::GenerateRandomUUID()), "-", "_");
+		result->staging_table = MySQLUtils::WriteIdentifier(bind_data.schema_name) + "." +
+		                        MySQLUtils::WriteIdentifier("__duckdb_copy_staging_" + uuid);
+		auto con = result->connection_pool->Acquire(context);
+		con.Execute("CREATE TABLE " + result->staging_table + " LIKE " + result->table_name);
+		result->connection_pool->Release(std::move(con));
+		target_name = result->staging_table;
+	}
+	result->options.column_writers = MySQLColumnWriter::GetWriters(bind_data.column_types, true);
+	result->options.load_data_query = GetLoadDataQuery(target_name, bind_data.column_names, false);
+	Value batch_bytes;
+	if (context.TryGetCurrentSetting("mysql_insert_batch_bytes", batch_bytes)) {
+		result->options.batch_bytes = UBigIntValue::Get(batch_bytes);
+	}
+	return std::move(result);
+}
+
+static unique_ptr<LocalFunctionData> MySQLCopyInitializeLocal(ExecutionContext &context, FunctionData &bind_data) {
+	return make_uniq<MySQLCopyLocalState>();
+}
+
+//===--------------------------------------------------------------------===//
+// Sink / Combine / Finalize
+//===--------------------------------------------------------------------===//
+static void MySQLCopySink(ExecutionContext &context, FunctionData &bind_data_p, GlobalFunctionData &gstate_p,
+                          LocalFunctionData &lstate_p, DataChunk &input) {
+	auto &bind_data = bind_data_p.Cast<MySQLCopyBindData>();
+	auto &gstate = gstate_p.Cast<MySQLCopyGlobalState>();
+	auto &lstate = lstate_p.Cast<MySQLCopyLocalState>();
+	if (!lstate.buffer) {
+		lstate.connection = gstate.connection_pool->Acquire();
+		if (!bind_data.swap) {
+			// the loads of all threads are committed together on finalize
+			lstate.connection.Execute("START TRANSACTION");
+		}
+		lstate.buffer = make_uniq<MySQLInsertBuffer>(context.client, gstate.options, gstate.stats);
+	}
+	lstate.buffer->Append(context.client, lstate.connection, input);
+	gstate.stats.rows += input.size();
+}
+
+static void MySQLCopyCombine(ExecutionContext &context, FunctionData &bind_data_p, GlobalFunctionData &gstate_p,
+                             LocalFunctionData &lstate_p) {
+	auto &bind_data = bind_data_p.Cast<MySQLCopyBindData>();
+	auto &gstate = gstate_p.Cast<MySQLCopyGlobalState>();
+	auto &lstate = lstate_p.Cast<MySQLCopyLocalState>();
+	if (!lstate.buffer) {
+		// this thread did not load anything
+		return;
+	}
+	lstate.buffer->Flush(lstate.connection);
+	if (bind_data.swap) {
+		// the staging table is not visible until it is swapped in - the loads are committed as they go
+		gstate.connection_pool->Release(std::move(lstate.connection));
+		return;
+	}
+	lock_guard<mutex> l(gstate.lock);
+	gstate.connections.push_back(std::move(lstate.connection));
+}
+
+static void MySQLCopyFinalize(ClientContext &context, FunctionData &bind_data_p, GlobalFunctionData &gstate_p) {
+	auto &bind_data = bind_data_p.Cast<MySQLCopyBindData>();
+	auto &gstate = gstate_p.Cast<MySQLCopyGlobalState>();
+	for (auto &con : gstate.connections) {
+		con.Execute("COMMIT");
+		gstate.connection_pool->Release(std::move(con));
+	}
+	gstate.connections.clear();
+	if (!gstate.staging_table.empty()) {
+		// atomically replace the table with the staging table, and drop the previous contents
+		auto uuid = StringUtil::Replace(UUID::ToString(UUID::GenerateRandomUUID()), "-", "_");
+		auto old_table = MySQLUtils::WriteIdentifier(bind_data.schema_name) + "." +
+		                 MySQLUtils::WriteIdentifier("__duckdb_copy_old_" + uuid);
+		auto con = gstate.connection_pool->Acquire(context);
+		auto start = std::chrono::steady_clock::now();
+		con.Execute("RENAME TABLE " + gstate.table_name + " TO " + old_table + ", " + gstate.staging_table + " TO " +
+		            gstate.table_name);
+		gstate.staging_table = string();
+		con.Execute("DROP TABLE " + old_table);
+		gstate.stats.statements += 2;
+		gstate.stats.query_micros += MySQLOperatorStats::ElapsedMicros(start);
+		gstate.connection_pool->Release(std::move(con));
+	}
+	gstate.catalog.GetResultCache().InvalidateTable(
+	    MySQLResultCache::GetTableKey(bind_data.schema_name, bind_data.table_name));
+	gstate.catalog.GetCachedTables().InvalidateTable(bind_data.schema_name, bind_data.table_name);
+}
+
+static CopyFunctionExecutionMode MySQLCopyExecutionMode(bool preserve_insertion_order, bool supports_batch_index) {
+	// the rows of a MySQL table have no order - so they can always be loaded in parallel
+	return CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
+}
+
+MySQLCopyFunction::MySQLCopyFunction() : CopyFunction("mysql") {
+	copy_to_bind = MySQLCopyBind;
+	copy_to_initialize_global = MySQLCopyInitializeGlobal;
+	copy_to_initialize_local = MySQLCopyInitializeLocal;
+	copy_to_sink = MySQLCopySink;
+	copy_to_combine = MySQLCopyCombine;
+	copy_to_finalize = MySQLCopyFinalize;
+	execution_mode = MySQLCopyExecutionMode;
+}
+
+} // namespace duckdb
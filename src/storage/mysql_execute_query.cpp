@@ -4,11 +4,14 @@
 #include "storage/mysql_catalog.hpp"
 #include "storage/mysql_transaction.hpp"
 #include "mysql_connection.hpp"
+#include "mysql_escape.hpp"
+#include "mysql_scanner.hpp"
 #include "duckdb/planner/operator/logical_update.hpp"
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/common/string_util.hpp"
 
 namespace duckdb {
 
@@ -17,6 +20,12 @@ MySQLExecuteQuery::MySQLExecuteQuery(LogicalOperator &op, string op_name_p, Tabl
       query(std::move(query_p)) {
 }
 
+MySQLExecuteQuery::MySQLExecuteQuery(LogicalOperator &op, string op_name_p, TableCatalogEntry &table,
+                                     unique_ptr<MySQLBatchedModification> batched_p)
+    : PhysicalOperator(PhysicalOperatorType::EXTENSION, op.types, 1), op_name(std::move(op_name_p)), table(table),
+      batched(std::move(batched_p)) {
+}
+
 //===--------------------------------------------------------------------===//
 // States
 //===--------------------------------------------------------------------===//
@@ -24,19 +33,130 @@ class MySQLExecuteQueryGlobalState : public GlobalSinkState {
 public:
 	explicit MySQLExecuteQueryGlobalState() : affected_rows(0) {
 	}
+	~MySQLExecuteQueryGlobalState() override {
+		if (connection.IsOpen()) {
+			connection_pool->Release(std::move(connection));
+		}
+	}
 
 	idx_t affected_rows;
+	//! The rows of the current batch - either the keys (DELETE) or SELECT lists of the keys and new values (UPDATE)
+	vector<string> batch_rows;
+	shared_ptr<MySQLConnectionPool> connection_pool;
+	//! The connection over which batches are committed (only if batches are committed separately)
+	MySQLConnection connection;
 };
 
 unique_ptr<GlobalSinkState> MySQLExecuteQuery::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<MySQLExecuteQueryGlobalState>();
+	auto result = make_uniq<MySQLExecuteQueryGlobalState>();
+	result->connection_pool = table.catalog.Cast<MySQLCatalog>().GetConnectionPoolPtr();
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+static string WriteMySQLValue(const Value &val) {
+	if (val.IsNull()) {
+		return "NULL";
+	}
+	switch (val.type().id()) {
+	case LogicalTypeId::BOOLEAN:
+		return BooleanValue::Get(val) ? "TRUE" : "FALSE";
+	case LogicalTypeId::BLOB: {
+		auto &blob = StringValue::Get(val);
+		string result(blob.size() * 2 + 3, '\0');
+		result[0] = 'X';
+		result[1] = '\'';
+		MySQLEscape::WriteHex(const_data_ptr_cast(blob.c_str()), blob.size(), &result[2]);
+		result.back() = '\'';
+		return result;
+	}
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return MySQLUtils::WriteLiteral(val.DefaultCastAs(LogicalType::TIMESTAMP).ToString());
+	default:
+		if (val.type().IsNumeric()) {
+			return val.ToString();
+		}
+		return MySQLUtils::WriteLiteral(val.ToString());
+	}
+}
+
+static string GetBatchStatement(const MySQLExecuteQuery &op, const vector<string> &rows) {
+	auto &batched = *op.batched;
+	auto table_name =
+	    MySQLUtils::WriteIdentifier(op.table.schema.name) + "." + MySQLUtils::WriteIdentifier(op.table.name);
+	auto key_name = MySQLUtils::WriteIdentifier(batched.key_column);
+	if (batched.update_columns.empty()) {
+		return "DELETE FROM " + table_name + " WHERE " + key_name + " IN (" + StringUtil::Join(rows, ", ") + ")";
+	}
+	// join the table with the keys and new values of the batch
+	string result = "UPDATE " + table_name + " JOIN (" + StringUtil::Join(rows, " UNION ALL ") + ") AS ";
+	result += "`__duckdb_batch` ON " + table_name + "." + key_name + " = `__duckdb_batch`.`__duckdb_key` SET ";
+	for (idx_t c = 0; c < batched.update_columns.size(); c++) {
+		if (c > 0) {
+			result += ", ";
+		}
+		result += table_name + "." + MySQLUtils::WriteIdentifier(batched.update_columns[c]) + " = ";
+		if (!batched.update_value_indexes[c].IsValid()) {
+			result += "DEFAULT";
+		} else {
+			result += "`__duckdb_batch`." + MySQLUtils::WriteIdentifier("v" + to_string(c));
+		}
+	}
+	return result;
+}
+
+static void FlushBatch(const MySQLExecuteQuery &op, ClientContext &context, MySQLExecuteQueryGlobalState &gstate) {
+	if (gstate.batch_rows.empty()) {
+		return;
+	}
+	auto statement = GetBatchStatement(op, gstate.batch_rows);
+	gstate.batch_rows.clear();
+	unique_ptr<MySQLResult> result;
+	if (op.batched->commit_batches) {
+		// the connection is in auto-commit mode - every batch is committed when it is run
+		if (!gstate.connection.IsOpen()) {
+			gstate.connection = gstate.connection_pool->Acquire(context);
+		}
+		result = gstate.connection.Query(statement);
+	} else {
+		auto &transaction = MySQLTransaction::Get(context, op.table.catalog);
+		result = transaction.GetConnection().Query(statement);
+	}
+	gstate.affected_rows += result->AffectedRows();
+}
+
 SinkResultType MySQLExecuteQuery::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
-	return SinkResultType::FINISHED;
+	if (!batched) {
+		// the query is run on finalize
+		return SinkResultType::FINISHED;
+	}
+	auto &gstate = input.global_state.Cast<MySQLExecuteQueryGlobalState>();
+	auto &row_ids = chunk.data[batched->row_id_index];
+	for (idx_t r = 0; r < chunk.size(); r++) {
+		auto row_id = row_ids.GetValue(r);
+		if (row_id.IsNull()) {
+			throw InternalException("MySQLExecuteQuery - row without a row id in batched %s", op_name);
+		}
+		string row = row_id.ToString();
+		if (!batched->update_columns.empty()) {
+			row = "SELECT " + row + " AS `__duckdb_key`";
+			for (idx_t c = 0; c < batched->update_value_indexes.size(); c++) {
+				auto &value_index = batched->update_value_indexes[c];
+				if (!value_index.IsValid()) {
+					continue;
+				}
+				row += ", " + WriteMySQLValue(chunk.data[value_index.GetIndex()].GetValue(r));
+				row += " AS " + MySQLUtils::WriteIdentifier("v" + to_string(c));
+			}
+		}
+		gstate.batch_rows.push_back(std::move(row));
+		if (gstate.batch_rows.size() >= batched->batch_size) {
+			FlushBatch(*this, context.client, gstate);
+		}
+	}
+	return SinkResultType::NEED_MORE_INPUT;
 }
 
 //===--------------------------------------------------------------------===//
@@ -45,10 +165,18 @@ SinkResultType MySQLExecuteQuery::Sink(ExecutionContext &context, DataChunk &chu
 SinkFinalizeType MySQLExecuteQuery::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                              OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<MySQLExecuteQueryGlobalState>();
-	auto &transaction = MySQLTransaction::Get(context, table.catalog);
-	auto &connection = transaction.GetConnection();
-	auto result = connection.Query(query);
-	gstate.affected_rows = result->AffectedRows();
+	if (batched) {
+		FlushBatch(*this, context, gstate);
+		if (gstate.connection.IsOpen()) {
+			gstate.connection_pool->Release(std::move(gstate.connection));
+		}
+	} else {
+		auto &transaction = MySQLTransaction::Get(context, table.catalog);
+		auto &connection = transaction.GetConnection();
+		auto result = connection.Query(query);
+		gstate.affected_rows = result->AffectedRows();
+	}
+	MySQLTransaction::Get(context, table.catalog).InvalidateTableOnCompletion(table.schema.name, table.name);
 	return SinkFinalizeType::READY;
 }
 
@@ -74,6 +202,9 @@ string MySQLExecuteQuery::GetName() const {
 InsertionOrderPreservingMap<string> MySQLExecuteQuery::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
 	result["Table Name"] = table.name;
+	if (batched) {
+		result["Batch Size"] = to_string(batched->batch_size);
+	}
 	return result;
 }
 
@@ -108,10 +239,20 @@ string ExtractFilters(PhysicalOperator &child, const string &statement) {
 		return ExtractFilters(*child.children[0], statement);
 	} else if (child.type == PhysicalOperatorType::TABLE_SCAN) {
 		auto &table_scan = child.Cast<PhysicalTableScan>();
+		string result;
+		if (table_scan.function.name == "mysql_scan" && table_scan.bind_data) {
+			auto &bind_data = table_scan.bind_data->Cast<MySQLBindData>();
+			if (!bind_data.query.empty() || !bind_data.limit.empty() || bind_data.sampled) {
+				throw NotImplementedException("Unsupported scan in %s statement - the scan has been replaced by a "
+				                              "query that cannot be used to identify the rows to modify",
+				                              statement);
+			}
+			// conditions that were pushed into the scan as SQL (e.g. OR, IN and function predicates)
+			result = bind_data.filter;
+		}
 		if (!table_scan.table_filters) {
-			return string();
+			return result;
 		}
-		string result;
 		for(auto &entry : table_scan.table_filters->filters) {
 			auto column_index = entry.first;
 			auto &filter = entry.second;
@@ -154,13 +295,60 @@ string ConstructDeleteStatement(LogicalDelete &op, PhysicalOperator &child) {
 	return result;
 }
 
+static bool UseBatchedModifications(ClientContext &context) {
+	Value batched;
+	if (!context.TryGetCurrentSetting("mysql_batched_modifications", batched)) {
+		return false;
+	}
+	return BooleanValue::Get(batched);
+}
+
+//! Returns the configuration for modifying the rows of a table in batches - or nullptr if the rows of the table
+//! cannot be identified by their row id
+static unique_ptr<MySQLBatchedModification> CreateBatchedModification(ClientContext &context, TableCatalogEntry &table,
+                                                                      bool requested) {
+	auto key_column = table.Cast<MySQLTableEntry>().GetRowIdColumn();
+	if (key_column.empty()) {
+		return nullptr;
+	}
+	auto result = make_uniq<MySQLBatchedModification>();
+	result->key_column = std::move(key_column);
+	Value batch_size;
+	if (context.TryGetCurrentSetting("mysql_modification_batch_size", batch_size)) {
+		result->batch_size = MaxValue<idx_t>(UBigIntValue::Get(batch_size), 1);
+	}
+	// committing every batch separately is not atomic - this is only done when batches were explicitly requested
+	// and the statement does not run within an explicit transaction
+	result->commit_batches = requested && context.transaction.IsAutoCommit();
+	return result;
+}
+
 unique_ptr<PhysicalOperator> MySQLCatalog::PlanDelete(ClientContext &context, LogicalDelete &op,
                                                       unique_ptr<PhysicalOperator> plan) {
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for deletion of a MySQL table");
 	}
-
-	auto result = make_uniq<MySQLExecuteQuery>(op, "DELETE", op.table, ConstructDeleteStatement(op, *plan));
+	auto requested = UseBatchedModifications(context);
+	auto batched = CreateBatchedModification(context, op.table, requested);
+	string query;
+	if (!batched) {
+		query = ConstructDeleteStatement(op, *plan);
+	} else if (!requested) {
+		// prefer a single statement - unless the plan cannot be translated into one
+		try {
+			query = ConstructDeleteStatement(op, *plan);
+			batched.reset();
+		} catch (NotImplementedException &) {
+			// delete the rows produced by the plan in batches instead
+		}
+	}
+	unique_ptr<MySQLExecuteQuery> result;
+	if (batched) {
+		batched->row_id_index = op.expressions[0]->Cast<BoundReferenceExpression>().index;
+		result = make_uniq<MySQLExecuteQuery>(op, "DELETE", op.table, std::move(batched));
+	} else {
+		result = make_uniq<MySQLExecuteQuery>(op, "DELETE", op.table, std::move(query));
+	}
 	result->children.push_back(std::move(plan));
 	return std::move(result);
 }
@@ -208,7 +396,47 @@ unique_ptr<PhysicalOperator> MySQLCatalog::PlanUpdate(ClientContext &context, Lo
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for updates of a MySQL table");
 	}
-	auto result = make_uniq<MySQLExecuteQuery>(op, "UPDATE", op.table, ConstructUpdateStatement(op, *plan));
+	auto requested = UseBatchedModifications(context);
+	auto batched = CreateBatchedModification(context, op.table, requested);
+	if (batched) {
+		// the row id is the last column produced by the child
+		batched->row_id_index = plan->types.size() - 1;
+		for (idx_t c = 0; c < op.columns.size(); c++) {
+			auto &col = op.table.GetColumn(op.table.GetColumns().PhysicalToLogical(op.columns[c]));
+			if (StringUtil::CIEquals(col.GetName(), batched->key_column)) {
+				// rows are identified by their key - so it cannot be updated in batches
+				batched.reset();
+				break;
+			}
+			batched->update_columns.push_back(col.GetName());
+			if (op.expressions[c]->type == ExpressionType::VALUE_DEFAULT) {
+				batched->update_value_indexes.emplace_back();
+			} else if (op.expressions[c]->type == ExpressionType::BOUND_REF) {
+				batched->update_value_indexes.emplace_back(op.expressions[c]->Cast<BoundReferenceExpression>().index);
+			} else {
+				batched.reset();
+				break;
+			}
+		}
+	}
+	string query;
+	if (!batched) {
+		query = ConstructUpdateStatement(op, *plan);
+	} else if (!requested) {
+		// prefer a single statement - unless the plan cannot be translated into one
+		try {
+			query = ConstructUpdateStatement(op, *plan);
+			batched.reset();
+		} catch (NotImplementedException &) {
+			// update the rows produced by the plan in batches instead
+		}
+	}
+	unique_ptr<MySQLExecuteQuery> result;
+	if (batched) {
+		result = make_uniq<MySQLExecuteQuery>(op, "UPDATE", op.table, std::move(batched));
+	} else {
+		result = make_uniq<MySQLExecuteQuery>(op, "UPDATE", op.table, std::move(query));
+	}
 	result->children.push_back(std::move(plan));
 	return std::move(result);
 }
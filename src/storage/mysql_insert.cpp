@@ -1,4 +1,5 @@
 #include "storage/mysql_insert.hpp"
+#include "storage/mysql_insert_buffer.hpp"
 #include "storage/mysql_catalog.hpp"
 #include "storage/mysql_transaction.hpp"
 #include "duckdb/planner/operator/logical_insert.hpp"
@@ -9,8 +10,13 @@
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "mysql_connection.hpp"
 #include "mysql_scanner.hpp"
+#include "mysql_scan_stats.hpp"
+#include "mysql_filter_pushdown.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/chrono.hpp"
 
 namespace duckdb {
 
@@ -30,17 +36,55 @@ MySQLInsert::MySQLInsert(LogicalOperator &op, SchemaCatalogEntry &schema, unique
 //===--------------------------------------------------------------------===//
 class MySQLInsertGlobalState : public GlobalSinkState {
 public:
-	explicit MySQLInsertGlobalState(ClientContext &context, MySQLTableEntry &table,
-	                                const vector<LogicalType> &varchar_types)
-	    : table(table), insert_count(0) {
-		varchar_chunk.Initialize(context, varchar_types);
+	explicit MySQLInsertGlobalState(MySQLTableEntry &table) : table(table), insert_count(0) {
+	}
+	~MySQLInsertGlobalState() override {
+		if (stats_log) {
+			stats_log->Record(stats);
+		}
+		if (staging_table.empty() || staging_dropped_by_transaction) {
+			return;
+		}
+		// the insert failed before the staging table was cleaned up - try to drop it
+		try {
+			auto con = connection_pool->Acquire();
+			con.Execute("DROP TABLE IF EXISTS " + staging_table);
+			connection_pool->Release(std::move(con));
+		} catch (...) {
+		}
 	}
 
 	MySQLTableEntry &table;
-	DataChunk varchar_chunk;
 	idx_t insert_count;
-	string base_insert_query;
-	string insert_values;
+	MySQLInsertOptions options;
+	//! The buffer used for serial inserts
+	unique_ptr<MySQLInsertBuffer> buffer;
+	//! The pool from which each thread borrows its own connection (parallel inserts only)
+	shared_ptr<MySQLConnectionPool> connection_pool;
+	//! The (qualified) name of the staging table the rows are inserted into, if any (parallel inserts with
+	//! mysql_parallel_insert_staging, or upserts through LOAD DATA)
+	string staging_table;
+	//! Whether the staging table is dropped by the transaction once it finishes (serial inserts into a staging table)
+	bool staging_dropped_by_transaction = false;
+	//! The query that moves the rows from the staging table into the target table
+	string staging_insert_query;
+	//! The per-thread connections with uncommitted inserts (parallel inserts without a staging table only)
+	vector<MySQLConnection> connections;
+	mutex lock;
+	//! The counters of the insert - recorded in the stats log of the catalog once the insert is finished
+	MySQLOperatorStats stats;
+	optional_ptr<MySQLStatsLog> stats_log;
+};
+
+class MySQLInsertLocalState : public LocalSinkState {
+public:
+	MySQLInsertLocalState(ClientContext &context, MySQLInsertGlobalState &gstate)
+	    : insert_count(0), buffer(context, gstate.options, gstate.stats) {
+	}
+
+	MySQLConnection connection;
+	idx_t insert_count;
+	MySQLInsertBuffer buffer;
 };
 
 vector<string> GetInsertColumns(const MySQLInsert &insert, MySQLTableEntry &entry) {
@@ -69,12 +113,15 @@ vector<string> GetInsertColumns(const MySQLInsert &insert, MySQLTableEntry &entr
 	return column_names;
 }
 
-string GetBaseInsertQuery(const MySQLTableEntry &table, const vector<string> &column_names) {
+//! Returns the start of an INSERT statement - rows that conflict with an existing row are skipped by INSERT IGNORE
+static string GetInsertKeyword(OnConflictAction on_conflict) {
+	return on_conflict == OnConflictAction::NOTHING ? "INSERT IGNORE INTO " : "INSERT INTO ";
+}
+
+string GetBaseInsertQuery(const string &table_name, const vector<string> &column_names, OnConflictAction on_conflict) {
 	string query;
-	query += "INSERT INTO ";
-	query += MySQLUtils::WriteIdentifier(table.schema.name);
-	query += ".";
-	query += MySQLUtils::WriteIdentifier(table.name);
+	query += GetInsertKeyword(on_conflict);
+	query += table_name;
 	query += " ";
 	if (!column_names.empty()) {
 		query += "(";
@@ -90,6 +137,33 @@ string GetBaseInsertQuery(const MySQLTableEntry &table, const vector<string> &co
 	return query;
 }
 
+string GetStagingInsertQuery(const string &table_name, const string &staging_table,
+                             const vector<string> &column_names, OnConflictAction on_conflict,
+                             const string &insert_suffix) {
+	string column_list;
+	for (idx_t c = 0; c < column_names.size(); c++) {
+		if (c > 0) {
+			column_list += ", ";
+		}
+		column_list += MySQLUtils::WriteIdentifier(column_names[c]);
+	}
+	string query = GetInsertKeyword(on_conflict) + table_name;
+	if (!column_names.empty()) {
+		query += " (" + column_list + ")";
+	}
+	query += " SELECT " + (column_names.empty() ? string("*") : column_list) + " FROM " + staging_table;
+	query += insert_suffix;
+	return query;
+}
+
+static bool UseLoadData(ClientContext &context) {
+	Value use_load_data;
+	if (context.TryGetCurrentSetting("mysql_use_load_data", use_load_data)) {
+		return BooleanValue::Get(use_load_data);
+	}
+	return false;
+}
+
 unique_ptr<GlobalSinkState> MySQLInsert::GetGlobalSinkState(ClientContext &context) const {
 	MySQLTableEntry *insert_table;
 	if (!table) {
@@ -100,127 +174,122 @@ unique_ptr<GlobalSinkState> MySQLInsert::GetGlobalSinkState(ClientContext &conte
 		insert_table = &table.get_mutable()->Cast<MySQLTableEntry>();
 	}
 	auto insert_columns = GetInsertColumns(*this, *insert_table);
-	vector<LogicalType> insert_types;
-	idx_t insert_column_count =
-	    insert_columns.empty() ? insert_table->GetColumns().LogicalColumnCount() : insert_columns.size();
-	for (idx_t c = 0; c < insert_column_count; c++) {
-		insert_types.push_back(LogicalType::VARCHAR);
-	}
-	auto result = make_uniq<MySQLInsertGlobalState>(context, *insert_table, insert_types);
-	result->base_insert_query = GetBaseInsertQuery(*insert_table, insert_columns);
+	auto result = make_uniq<MySQLInsertGlobalState>(*insert_table);
+	auto table_name = MySQLUtils::WriteIdentifier(insert_table->schema.name) + "." +
+	                  MySQLUtils::WriteIdentifier(insert_table->name);
+	auto target_name = table_name;
+	auto &mysql_catalog = insert_table->catalog.Cast<MySQLCatalog>();
+	result->stats_log = &mysql_catalog.GetStatsLog();
+	result->stats.database_name = mysql_catalog.GetName();
+	result->stats.operator_name = table ? "insert" : "create_table_as";
+	result->stats.target = insert_table->name;
+	result->connection_pool = mysql_catalog.GetConnectionPoolPtr();
+	if (on_conflict == OnConflictAction::UPDATE) {
+		result->options.insert_suffix = " ON DUPLICATE KEY UPDATE " + update_assignments;
+	}
+	auto use_load_data = UseLoadData(context);
+	// the writer of each column is chosen once from its type - the rows are formatted by these writers
+	result->options.column_writers = MySQLColumnWriter::GetWriters(children[0]->GetTypes(), use_load_data);
+	// LOAD DATA cannot skip or update conflicting rows without turning them into warnings (which fail the insert)
+	// upserts therefore load the rows into a staging table, and resolve the conflicts when moving them on finalize
+	auto load_into_staging_table = use_load_data && on_conflict != OnConflictAction::THROW;
+	if ((parallel && use_staging_table) || load_into_staging_table) {
+		// threads insert into a staging table that is moved into the target table in the transaction on finalize
+		auto uuid = StringUtil::Replace(UUID::ToString(UUID::GenerateRandomUUID()), "-", "_");
+		auto staging_name = "__duckdb_insert_staging_" + uuid;
+		result->staging_table = MySQLUtils::WriteIdentifier(insert_table->schema.name) + "." +
+		                        MySQLUtils::WriteIdentifier(staging_name);
+		// CREATE TABLE implicitly commits - so we create the staging table over a separate connection
+		auto con = result->connection_pool->Acquire(context);
+		con.Execute("CREATE TABLE " + result->staging_table + " LIKE " + table_name);
+		result->connection_pool->Release(std::move(con));
+		if (!parallel) {
+			// the transaction loads into the staging table and locks it - so it can only be dropped once it finishes
+			MySQLTransaction::Get(context, insert_table->catalog).DropTableOnCompletion(result->staging_table);
+			result->staging_dropped_by_transaction = true;
+		}
+		result->staging_insert_query = GetStagingInsertQuery(table_name, result->staging_table, insert_columns,
+		                                                     on_conflict, result->options.insert_suffix);
+		target_name = result->staging_table;
+	}
+	result->options.base_insert_query = GetBaseInsertQuery(target_name, insert_columns, on_conflict);
+	if (use_load_data) {
+		// rows that appear more than once in the staging table are resolved by keeping the last one
+		result->options.load_data_query = GetLoadDataQuery(target_name, insert_columns, load_into_staging_table);
+	}
+	Value batch_bytes;
+	if (context.TryGetCurrentSetting("mysql_insert_batch_bytes", batch_bytes)) {
+		result->options.batch_bytes = UBigIntValue::Get(batch_bytes);
+	}
+	if (result->options.batch_bytes == 0) {
+		// leave plenty of room below max_allowed_packet, as a batch can overshoot its size by one row
+		auto &transaction = MySQLTransaction::Get(context, insert_table->catalog);
+		result->options.max_batch_bytes = transaction.GetConnection().GetMaxAllowedPacket() / 4;
+	}
+	if (!parallel) {
+		result->buffer = make_uniq<MySQLInsertBuffer>(context, result->options, result->stats);
+	}
 	return std::move(result);
 }
 
+unique_ptr<LocalSinkState> MySQLInsert::GetLocalSinkState(ExecutionContext &context) const {
+	auto &gstate = sink_state->Cast<MySQLInsertGlobalState>();
+	return make_uniq<MySQLInsertLocalState>(context.client, gstate);
+}
+
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
-static void MySQLCastBlob(const Vector &input, Vector &result, idx_t count) {
-	static constexpr const char *HEX_TABLE = "0123456789ABCDEF";
-	auto input_data = FlatVector::GetData<string_t>(input);
-	auto result_data = FlatVector::GetData<string_t>(result);
-	for (idx_t r = 0; r < count; r++) {
-		if (FlatVector::IsNull(input, r)) {
-			FlatVector::SetNull(result, r, true);
-			continue;
+static MySQLConnection &GetLocalConnection(MySQLInsertGlobalState &gstate, MySQLInsertLocalState &lstate) {
+	if (!lstate.connection.IsOpen()) {
+		lstate.connection = gstate.connection_pool->Acquire();
+		if (gstate.staging_table.empty()) {
+			// without a staging table the inserts of all threads are committed together on finalize
+			lstate.connection.Execute("START TRANSACTION");
 		}
-		auto blob_data = const_data_ptr_cast(input_data[r].GetData());
-		auto blob_size = input_data[r].GetSize();
-		string result_blob = "0x";
-		for (idx_t b = 0; b < blob_size; b++) {
-			auto blob_entry = blob_data[b];
-			auto byte_a = blob_entry >> 4;
-			auto byte_b = blob_entry & 0x0F;
-			result_blob += string(1, HEX_TABLE[byte_a]);
-			result_blob += string(1, HEX_TABLE[byte_b]);
-		}
-		result_data[r] = StringVector::AddString(result, result_blob);
 	}
+	return lstate.connection;
 }
 
 SinkResultType MySQLInsert::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
-	static constexpr const idx_t INSERT_FLUSH_SIZE = 8000;
-
 	auto &gstate = input.global_state.Cast<MySQLInsertGlobalState>();
+	if (parallel) {
+		auto &lstate = input.local_state.Cast<MySQLInsertLocalState>();
+		auto &con = GetLocalConnection(gstate, lstate);
+		lstate.buffer.Append(context.client, con, chunk);
+		lstate.insert_count += chunk.size();
+		return SinkResultType::NEED_MORE_INPUT;
+	}
 	auto &transaction = MySQLTransaction::Get(context.client, gstate.table.catalog);
 	auto &con = transaction.GetConnection();
-	// cast to varchar
-	D_ASSERT(chunk.ColumnCount() == gstate.varchar_chunk.ColumnCount());
-	chunk.Flatten();
-	gstate.varchar_chunk.Reset();
-	for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
-		switch (chunk.data[c].GetType().id()) {
-		case LogicalTypeId::BLOB:
-			MySQLCastBlob(chunk.data[c], gstate.varchar_chunk.data[c], chunk.size());
-			break;
-		case LogicalTypeId::TIMESTAMP_TZ: {
-			Vector timestamp_vector(LogicalType::TIMESTAMP);
-			timestamp_vector.Reinterpret(chunk.data[c]);
-			VectorOperations::Cast(context.client, timestamp_vector, gstate.varchar_chunk.data[c], chunk.size());
-			break;
-		}
-		default:
-			VectorOperations::Cast(context.client, chunk.data[c], gstate.varchar_chunk.data[c], chunk.size());
-			break;
-		}
+	gstate.buffer->Append(context.client, con, chunk);
+	gstate.insert_count += chunk.size();
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Combine
+//===--------------------------------------------------------------------===//
+SinkCombineResultType MySQLInsert::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	if (!parallel) {
+		return SinkCombineResultType::FINISHED;
 	}
-	gstate.varchar_chunk.SetCardinality(chunk.size());
-	// for each column type check if we need to add quotes or not
-	vector<bool> add_quotes;
-	for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
-		bool add_quotes_for_type;
-		switch (chunk.data[c].GetType().id()) {
-		case LogicalTypeId::BOOLEAN:
-		case LogicalTypeId::SMALLINT:
-		case LogicalTypeId::INTEGER:
-		case LogicalTypeId::BIGINT:
-		case LogicalTypeId::TINYINT:
-		case LogicalTypeId::UTINYINT:
-		case LogicalTypeId::USMALLINT:
-		case LogicalTypeId::UINTEGER:
-		case LogicalTypeId::UBIGINT:
-		case LogicalTypeId::FLOAT:
-		case LogicalTypeId::DOUBLE:
-		case LogicalTypeId::BLOB:
-			add_quotes_for_type = false;
-			break;
-		default:
-			add_quotes_for_type = true;
-			break;
-		}
-		add_quotes.push_back(add_quotes_for_type);
+	auto &gstate = input.global_state.Cast<MySQLInsertGlobalState>();
+	auto &lstate = input.local_state.Cast<MySQLInsertLocalState>();
+	if (!lstate.connection.IsOpen()) {
+		// this thread did not insert anything
+		return SinkCombineResultType::FINISHED;
 	}
-
-	// generate INSERT INTO statements
-	for (idx_t r = 0; r < chunk.size(); r++) {
-		if (!gstate.insert_values.empty()) {
-			gstate.insert_values += ", ";
-		}
-		gstate.insert_values += "(";
-		for (idx_t c = 0; c < gstate.varchar_chunk.ColumnCount(); c++) {
-			if (c > 0) {
-				gstate.insert_values += ", ";
-			}
-			if (FlatVector::IsNull(gstate.varchar_chunk.data[c], r)) {
-				gstate.insert_values += "NULL";
-			} else {
-				auto data = FlatVector::GetData<string_t>(gstate.varchar_chunk.data[c]);
-				if (add_quotes[c]) {
-					gstate.insert_values += MySQLUtils::WriteLiteral(data[r].GetString());
-				} else {
-					gstate.insert_values += data[r].GetString();
-				}
-			}
-		}
-		gstate.insert_values += ")";
-		if (gstate.insert_values.size() >= INSERT_FLUSH_SIZE) {
-			// perform the actual insert
-			con.Query(gstate.base_insert_query + gstate.insert_values);
-			// reset the to-be-inserted values
-			gstate.insert_values = string();
-		}
+	lstate.buffer.Flush(lstate.connection);
+	lock_guard<mutex> l(gstate.lock);
+	gstate.insert_count += lstate.insert_count;
+	if (gstate.staging_table.empty()) {
+		// keep the connection around until all threads are done so the inserts can be committed together
+		gstate.connections.push_back(std::move(lstate.connection));
+	} else {
+		gstate.connection_pool->Release(std::move(lstate.connection));
 	}
-	gstate.insert_count += chunk.size();
-	return SinkResultType::NEED_MORE_INPUT;
+	return SinkCombineResultType::FINISHED;
 }
 
 //===--------------------------------------------------------------------===//
@@ -229,12 +298,35 @@ SinkResultType MySQLInsert::Sink(ExecutionContext &context, DataChunk &chunk, Op
 SinkFinalizeType MySQLInsert::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                        OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<MySQLInsertGlobalState>();
-	if (!gstate.insert_values.empty()) {
+	if (gstate.buffer) {
 		// perform the final insert
 		auto &transaction = MySQLTransaction::Get(context, gstate.table.catalog);
 		auto &con = transaction.GetConnection();
-		con.Query(gstate.base_insert_query + gstate.insert_values);
+		gstate.buffer->Flush(con);
+	}
+	// all threads have finished inserting - commit their connections
+	for (auto &con : gstate.connections) {
+		con.Execute("COMMIT");
+		gstate.connection_pool->Release(std::move(con));
 	}
+	gstate.connections.clear();
+	if (!gstate.staging_table.empty()) {
+		// move the rows from the staging table into the target table as part of the transaction
+		// the staging table is locked by the transaction from here on - so it can only be dropped after it finishes
+		auto &transaction = MySQLTransaction::Get(context, gstate.table.catalog);
+		if (!gstate.staging_dropped_by_transaction) {
+			transaction.DropTableOnCompletion(gstate.staging_table);
+		}
+		gstate.staging_table = string();
+		auto &con = transaction.GetConnection();
+		auto start = std::chrono::steady_clock::now();
+		con.Execute(gstate.staging_insert_query);
+		gstate.stats.statements++;
+		gstate.stats.query_micros += MySQLOperatorStats::ElapsedMicros(start);
+	}
+	gstate.stats.rows = gstate.insert_count;
+	MySQLTransaction::Get(context, gstate.table.catalog)
+	    .InvalidateTableOnCompletion(gstate.table.schema.name, gstate.table.name);
 	return SinkFinalizeType::READY;
 }
 
@@ -259,12 +351,97 @@ string MySQLInsert::GetName() const {
 InsertionOrderPreservingMap<string> MySQLInsert::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
 	result["Table Name"] = table ? table->name : info->Base().table;
+	if (on_conflict == OnConflictAction::NOTHING) {
+		result["On Conflict"] = "DO NOTHING";
+	} else if (on_conflict == OnConflictAction::UPDATE) {
+		result["On Conflict"] = "DO UPDATE SET " + update_assignments;
+	}
 	return result;
 }
 
 //===--------------------------------------------------------------------===//
 // Plan
 //===--------------------------------------------------------------------===//
+void MySQLInsert::SetParallel(ClientContext &context, Catalog &catalog) {
+	Value parallel_insert;
+	if (!context.TryGetCurrentSetting("mysql_parallel_insert", parallel_insert) ||
+	    !BooleanValue::Get(parallel_insert)) {
+		return;
+	}
+	Value staging;
+	if (context.TryGetCurrentSetting("mysql_parallel_insert_staging", staging) && BooleanValue::Get(staging)) {
+		// the staging table is moved into the target table within the transaction - so this is always safe
+		parallel = true;
+		use_staging_table = true;
+		return;
+	}
+	// without a staging table the inserts happen outside of the transaction, which is only allowed in auto-commit mode
+	parallel = MySQLTransaction::CanUseSeparateConnection(context, catalog);
+}
+
+//! Translates a SET expression of ON CONFLICT DO UPDATE into the value of an ON DUPLICATE KEY UPDATE assignment
+static string GetUpdateValue(const ColumnList &columns, const Expression &set_expression) {
+	reference<const Expression> expr(set_expression);
+	while (expr.get().GetExpressionClass() == ExpressionClass::BOUND_CAST) {
+		// MySQL converts the value to the type of the column itself
+		expr = *expr.get().Cast<BoundCastExpression>().child;
+	}
+	if (expr.get().GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+		auto &value = expr.get().Cast<BoundConstantExpression>().value;
+		if (value.type().id() == LogicalTypeId::BOOLEAN && !value.IsNull()) {
+			return BooleanValue::Get(value) ? "1" : "0";
+		}
+		return MySQLFilterPushdown::TransformConstant(value);
+	}
+	if (expr.get().GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		// the excluded columns come first, followed by the existing values of the conflicting row
+		auto index = expr.get().Cast<BoundReferenceExpression>().index;
+		if (index < columns.PhysicalColumnCount()) {
+			// excluded.<column> - VALUES(<column>) is the value that would have been inserted
+			auto &column = columns.GetColumn(PhysicalIndex(index));
+			return "VALUES(" + MySQLUtils::WriteIdentifier(column.GetName()) + ")";
+		}
+	}
+	throw BinderException("ON CONFLICT DO UPDATE for MySQL tables only supports setting columns to constants or to "
+	                      "excluded values, but got \"%s\"",
+	                      set_expression.ToString());
+}
+
+void MySQLInsert::SetOnConflict(ClientContext &context, LogicalInsert &op) {
+	if (op.action_type == OnConflictAction::THROW) {
+		return;
+	}
+	if (op.on_conflict_condition) {
+		throw BinderException("ON CONFLICT ... WHERE is not supported for insertion into MySQL table");
+	}
+	if (op.do_update_condition) {
+		throw BinderException("ON CONFLICT DO UPDATE ... WHERE is not supported for insertion into MySQL table");
+	}
+	auto &mysql_table = op.table.Cast<MySQLTableEntry>();
+	if (!op.on_conflict_filter.empty() && mysql_table.GetUniqueIndexes(context).size() > 1) {
+		// MySQL resolves conflicts on any unique index - we cannot restrict it to the conflict target
+		throw BinderException("ON CONFLICT with a conflict target is not supported for insertion into MySQL table "
+		                      "\"%s\" because it has more than one unique index - omit the conflict target to resolve "
+		                      "conflicts on all unique indexes",
+		                      mysql_table.name);
+	}
+	if (op.action_type == OnConflictAction::NOTHING || op.set_columns.empty()) {
+		on_conflict = OnConflictAction::NOTHING;
+		return;
+	}
+	// DO UPDATE and INSERT OR REPLACE (which DuckDB binds as an update of all columns)
+	auto &columns = op.table.GetColumns();
+	on_conflict = OnConflictAction::UPDATE;
+	for (idx_t i = 0; i < op.set_columns.size(); i++) {
+		if (i > 0) {
+			update_assignments += ", ";
+		}
+		update_assignments += MySQLUtils::WriteIdentifier(columns.GetColumn(op.set_columns[i]).GetName());
+		update_assignments += " = ";
+		update_assignments += GetUpdateValue(columns, *op.expressions[i]);
+	}
+}
+
 unique_ptr<PhysicalOperator> AddCastToMySQLTypes(ClientContext &context, unique_ptr<PhysicalOperator> plan) {
 	// check if we need to cast anything
 	bool require_cast = false;
@@ -307,12 +484,11 @@ unique_ptr<PhysicalOperator> MySQLCatalog::PlanInsert(ClientContext &context, Lo
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for insertion into MySQL table");
 	}
-	if (op.action_type != OnConflictAction::THROW) {
-		throw BinderException("ON CONFLICT clause not yet supported for insertion into MySQL table");
-	}
 	plan = AddCastToMySQLTypes(context, std::move(plan));
 
 	auto insert = make_uniq<MySQLInsert>(op, op.table, op.column_index_map);
+	insert->SetOnConflict(context, op);
+	insert->SetParallel(context, *this);
 	insert->children.push_back(std::move(plan));
 	return std::move(insert);
 }
@@ -322,6 +498,7 @@ unique_ptr<PhysicalOperator> MySQLCatalog::PlanCreateTableAs(ClientContext &cont
 	plan = AddCastToMySQLTypes(context, std::move(plan));
 
 	auto insert = make_uniq<MySQLInsert>(op, op.schema, std::move(op.info));
+	insert->SetParallel(context, *this);
 	insert->children.push_back(std::move(plan));
 	return std::move(insert);
 }
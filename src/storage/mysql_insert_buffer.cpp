@@ -0,0 +1,469 @@
+#include "storage/mysql_insert_buffer.hpp"
+#include "mysql_connection.hpp"
+#include "mysql_escape.hpp"
+#include "mysql_scan_stats.hpp"
+#include "mysql_utils.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/operator/string_cast.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+
+namespace duckdb {
+
+//! Appends a quoted string literal, escaping quotes and backslashes
+static void WriteEscapedLiteral(string &target, const char *data, idx_t size) {
+	// reserve space for the worst case (every character escaped) and write in-place
+	auto offset = target.size();
+	target.resize(offset + size * 2 + 2);
+	auto result = &target[offset];
+	result[0] = '\'';
+	auto length = MySQLEscape::EscapeQuoted(data, size, '\'', result + 1);
+	result[length + 1] = '\'';
+	target.resize(offset + length + 2);
+}
+
+//! Appends a blob as a hexadecimal literal (X'...')
+static void WriteHexLiteral(string &target, const_data_ptr_t data, idx_t size) {
+	auto offset = target.size();
+	target.resize(offset + size * 2 + 3);
+	auto result = &target[offset];
+	result[0] = 'X';
+	result[1] = '\'';
+	MySQLEscape::WriteHex(data, size, result + 2);
+	result[2 + size * 2] = '\'';
+}
+
+//===--------------------------------------------------------------------===//
+// Column Writers
+//===--------------------------------------------------------------------===//
+//! Writes the digits of value into buffer - returns the number of written digits
+template <class T>
+static idx_t WriteUnsigned(T value, char *buffer) {
+	char digits[20];
+	idx_t length = 0;
+	do {
+		digits[length++] = char('0' + value % 10);
+		value /= 10;
+	} while (value > 0);
+	for (idx_t i = 0; i < length; i++) {
+		buffer[i] = digits[length - 1 - i];
+	}
+	return length;
+}
+
+//! Writes the (width) lowest digits of value into buffer, padded with leading zeros
+static idx_t WritePadded(uint64_t value, idx_t width, char *buffer) {
+	for (idx_t i = width; i > 0; i--) {
+		buffer[i - 1] = char('0' + value % 10);
+		value /= 10;
+	}
+	return width;
+}
+
+template <class T>
+static idx_t FormatUnsigned(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer) {
+	return WriteUnsigned(FlatVector::GetData<T>(input)[row], buffer);
+}
+
+template <class T, class UNSIGNED>
+static idx_t FormatSigned(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer) {
+	auto value = FlatVector::GetData<T>(input)[row];
+	if (value >= 0) {
+		return WriteUnsigned(UNSIGNED(value), buffer);
+	}
+	// negate in the unsigned domain, which is also defined for the minimum value
+	buffer[0] = '-';
+	return 1 + WriteUnsigned(UNSIGNED(0) - UNSIGNED(value), buffer + 1);
+}
+
+template <class T, class UNSIGNED>
+static idx_t FormatDecimal(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer) {
+	auto value = FlatVector::GetData<T>(input)[row];
+	idx_t length = 0;
+	UNSIGNED magnitude = UNSIGNED(value);
+	if (value < 0) {
+		buffer[length++] = '-';
+		magnitude = UNSIGNED(0) - UNSIGNED(value);
+	}
+	if (writer.decimal_scale == 0) {
+		return length + WriteUnsigned(magnitude, buffer + length);
+	}
+	length += WriteUnsigned(uint64_t(magnitude / writer.decimal_divisor), buffer + length);
+	buffer[length++] = '.';
+	length += WritePadded(uint64_t(magnitude % writer.decimal_divisor), writer.decimal_scale, buffer + length);
+	return length;
+}
+
+static idx_t FormatBoolean(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer) {
+	if (FlatVector::GetData<bool>(input)[row]) {
+		memcpy(buffer, "true", 4);
+		return 4;
+	}
+	memcpy(buffer, "false", 5);
+	return 5;
+}
+
+//! LOAD DATA does not understand "true" and "false" - booleans are written as 1 and 0
+static idx_t FormatBooleanAsInteger(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer) {
+	buffer[0] = FlatVector::GetData<bool>(input)[row] ? '1' : '0';
+	return 1;
+}
+
+//! Copies the text of a value that is not formatted by hand (infinities and years outside of 0-9999)
+static idx_t WriteText(const string &text, char *buffer) {
+	auto length = MinValue<idx_t>(text.size(), MySQLColumnWriter::MAX_FORMATTED_SIZE);
+	memcpy(buffer, text.c_str(), length);
+	return length;
+}
+
+static idx_t WriteDate(int32_t year, int32_t month, int32_t day, char *buffer) {
+	idx_t length = WritePadded(uint64_t(year), 4, buffer);
+	buffer[length++] = '-';
+	length += WritePadded(uint64_t(month), 2, buffer + length);
+	buffer[length++] = '-';
+	length += WritePadded(uint64_t(day), 2, buffer + length);
+	return length;
+}
+
+static idx_t FormatDate(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer) {
+	auto date = FlatVector::GetData<date_t>(input)[row];
+	if (!Date::IsFinite(date)) {
+		return WriteText(Date::ToString(date), buffer);
+	}
+	int32_t year, month, day;
+	Date::Convert(date, year, month, day);
+	if (year <= 0 || year > 9999) {
+		return WriteText(Date::ToString(date), buffer);
+	}
+	return WriteDate(year, month, day, buffer);
+}
+
+//! Formats TIMESTAMP and TIMESTAMP WITH TIME ZONE values - the latter are written in UTC, without a time zone
+static idx_t FormatTimestamp(const MySQLColumnWriter &writer, Vector &input, idx_t row, char *buffer) {
+	auto timestamp = FlatVector::GetData<timestamp_t>(input)[row];
+	if (!Timestamp::IsFinite(timestamp)) {
+		return WriteText(Timestamp::ToString(timestamp), buffer);
+	}
+	date_t date;
+	dtime_t time;
+	Timestamp::Convert(timestamp, date, time);
+	int32_t year, month, day;
+	Date::Convert(date, year, month, day);
+	if (year <= 0 || year > 9999) {
+		return WriteText(Timestamp::ToString(timestamp), buffer);
+	}
+	int32_t hour, minute, second, micros;
+	Time::Convert(time, hour, minute, second, micros);
+	idx_t length = WriteDate(year, month, day, buffer);
+	buffer[length++] = ' ';
+	length += WritePadded(uint64_t(hour), 2, buffer + length);
+	buffer[length++] = ':';
+	length += WritePadded(uint64_t(minute), 2, buffer + length);
+	buffer[length++] = ':';
+	length += WritePadded(uint64_t(second), 2, buffer + length);
+	if (micros > 0) {
+		// as DuckDB does, trailing zeros of the fractional seconds are omitted
+		buffer[length++] = '.';
+		length += WritePadded(uint64_t(micros), 6, buffer + length);
+		while (buffer[length - 1] == '0') {
+			length--;
+		}
+	}
+	return length;
+}
+
+static MySQLColumnWriter FormattedWriter(mysql_format_value_t format_value, bool quote) {
+	MySQLColumnWriter writer;
+	writer.format = MySQLColumnFormat::FORMATTED;
+	writer.format_value = format_value;
+	writer.quote = quote;
+	return writer;
+}
+
+template <class T, class UNSIGNED>
+static MySQLColumnWriter DecimalWriter(uint8_t scale) {
+	auto writer = FormattedWriter(FormatDecimal<T, UNSIGNED>, false);
+	writer.decimal_scale = scale;
+	for (idx_t i = 0; i < scale; i++) {
+		writer.decimal_divisor *= 10;
+	}
+	return writer;
+}
+
+static MySQLColumnWriter GetWriter(const LogicalType &type, bool load_data) {
+	MySQLColumnWriter writer;
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		return FormattedWriter(load_data ? FormatBooleanAsInteger : FormatBoolean, false);
+	case LogicalTypeId::TINYINT:
+		return FormattedWriter(FormatSigned<int8_t, uint8_t>, false);
+	case LogicalTypeId::SMALLINT:
+		return FormattedWriter(FormatSigned<int16_t, uint16_t>, false);
+	case LogicalTypeId::INTEGER:
+		return FormattedWriter(FormatSigned<int32_t, uint32_t>, false);
+	case LogicalTypeId::BIGINT:
+		return FormattedWriter(FormatSigned<int64_t, uint64_t>, false);
+	case LogicalTypeId::UTINYINT:
+		return FormattedWriter(FormatUnsigned<uint8_t>, false);
+	case LogicalTypeId::USMALLINT:
+		return FormattedWriter(FormatUnsigned<uint16_t>, false);
+	case LogicalTypeId::UINTEGER:
+		return FormattedWriter(FormatUnsigned<uint32_t>, false);
+	case LogicalTypeId::UBIGINT:
+		return FormattedWriter(FormatUnsigned<uint64_t>, false);
+	case LogicalTypeId::DECIMAL: {
+		auto scale = DecimalType::GetScale(type);
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			return DecimalWriter<int16_t, uint16_t>(scale);
+		case PhysicalType::INT32:
+			return DecimalWriter<int32_t, uint32_t>(scale);
+		case PhysicalType::INT64:
+			return DecimalWriter<int64_t, uint64_t>(scale);
+		default:
+			// wide decimals are cast
+			break;
+		}
+		break;
+	}
+	case LogicalTypeId::DATE:
+		return FormattedWriter(FormatDate, true);
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return FormattedWriter(FormatTimestamp, true);
+	case LogicalTypeId::FLOAT:
+		writer.format = MySQLColumnFormat::FLOAT;
+		writer.quote = false;
+		break;
+	case LogicalTypeId::DOUBLE:
+		writer.format = MySQLColumnFormat::DOUBLE;
+		writer.quote = false;
+		break;
+	case LogicalTypeId::VARCHAR:
+		writer.format = MySQLColumnFormat::VARCHAR;
+		break;
+	case LogicalTypeId::BLOB:
+		writer.format = MySQLColumnFormat::BLOB;
+		writer.quote = false;
+		break;
+	default:
+		break;
+	}
+	return writer;
+}
+
+vector<MySQLColumnWriter> MySQLColumnWriter::GetWriters(const vector<LogicalType> &types, bool load_data) {
+	vector<MySQLColumnWriter> writers;
+	for (auto &type : types) {
+		writers.push_back(GetWriter(type, load_data));
+	}
+	return writers;
+}
+
+//===--------------------------------------------------------------------===//
+// Insert Buffer
+//===--------------------------------------------------------------------===//
+MySQLInsertBuffer::MySQLInsertBuffer(ClientContext &context, const MySQLInsertOptions &options,
+                                     MySQLOperatorStats &stats)
+    : stats(stats), column_writers(options.column_writers), has_cast_columns(false),
+      string_heap(LogicalType::VARCHAR, nullptr), insert_query(options.base_insert_query),
+      base_insert_size(insert_query.size()), insert_suffix(options.insert_suffix),
+      load_data_query(options.load_data_query), load_data(!load_data_query.empty()),
+      batch_size(options.batch_bytes, options.max_batch_bytes),
+      load_data_flush_size(options.batch_bytes == 0 ? LOAD_DATA_FLUSH_SIZE : options.batch_bytes) {
+	vector<LogicalType> varchar_types;
+	for (auto &writer : column_writers) {
+		if (writer.format == MySQLColumnFormat::CAST) {
+			has_cast_columns = true;
+		}
+		varchar_types.push_back(LogicalType::VARCHAR);
+	}
+	if (has_cast_columns) {
+		varchar_chunk.Initialize(context, varchar_types);
+	}
+}
+
+void MySQLInsertBuffer::Append(ClientContext &context, MySQLConnection &con, DataChunk &chunk) {
+	D_ASSERT(chunk.ColumnCount() == column_writers.size());
+	chunk.Flatten();
+	if (has_cast_columns) {
+		CastToVarchar(context, chunk);
+	}
+	// the text of the floating point values of the previous chunk has been written - release it
+	string_heap.SetAuxiliary(nullptr);
+	if (load_data) {
+		AppendLoadData(con, chunk);
+	} else {
+		AppendInsert(con, chunk);
+	}
+}
+
+void MySQLInsertBuffer::Flush(MySQLConnection &con) {
+	if (load_data_writer.Size() > 0) {
+		FlushLoadData(con);
+	}
+	if (insert_query.size() > base_insert_size) {
+		FlushInsert(con);
+	}
+}
+
+void MySQLInsertBuffer::CastToVarchar(ClientContext &context, DataChunk &chunk) {
+	varchar_chunk.Reset();
+	for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+		if (column_writers[c].format != MySQLColumnFormat::CAST) {
+			continue;
+		}
+		VectorOperations::Cast(context, chunk.data[c], varchar_chunk.data[c], chunk.size());
+	}
+	varchar_chunk.SetCardinality(chunk.size());
+}
+
+void MySQLInsertBuffer::FlushLoadData(MySQLConnection &con) {
+	auto start = std::chrono::steady_clock::now();
+	con.LoadData(load_data_query, load_data_writer.stream.GetData(), load_data_writer.Size());
+	stats.statements++;
+	stats.bytes += load_data_writer.Size();
+	stats.query_micros += MySQLOperatorStats::ElapsedMicros(start);
+	load_data_writer.Reset();
+}
+
+void MySQLInsertBuffer::FlushInsert(MySQLConnection &con) {
+	auto start = std::chrono::steady_clock::now();
+	insert_query += insert_suffix;
+	con.Query(insert_query);
+	auto elapsed_micros = MySQLOperatorStats::ElapsedMicros(start);
+	batch_size.Update(elapsed_micros);
+	stats.statements++;
+	stats.bytes += insert_query.size();
+	stats.query_micros += elapsed_micros;
+	// reset the to-be-inserted values - this keeps the allocated buffer around for the next batch
+	insert_query.resize(base_insert_size);
+}
+
+void MySQLInsertBuffer::AppendLoadData(MySQLConnection &con, DataChunk &chunk) {
+	char buffer[MySQLColumnWriter::MAX_FORMATTED_SIZE];
+	for (idx_t r = 0; r < chunk.size(); r++) {
+		for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+			if (c > 0) {
+				load_data_writer.WriteSeparator();
+			}
+			auto &writer = column_writers[c];
+			auto &input = GetInput(chunk, c);
+			if (FlatVector::IsNull(input, r)) {
+				load_data_writer.WriteNull();
+				continue;
+			}
+			switch (writer.format) {
+			case MySQLColumnFormat::FORMATTED:
+				// formatted values contain no characters that need to be escaped
+				load_data_writer.WriteRaw(buffer, writer.format_value(writer, input, r, buffer));
+				break;
+			case MySQLColumnFormat::FLOAT: {
+				auto text = StringCast::Operation<float>(FlatVector::GetData<float>(input)[r], string_heap);
+				load_data_writer.WriteRaw(text.GetData(), text.GetSize());
+				break;
+			}
+			case MySQLColumnFormat::DOUBLE: {
+				auto text = StringCast::Operation<double>(FlatVector::GetData<double>(input)[r], string_heap);
+				load_data_writer.WriteRaw(text.GetData(), text.GetSize());
+				break;
+			}
+			default:
+				// strings and blobs are written as their escaped bytes
+				load_data_writer.WriteVarchar(FlatVector::GetData<string_t>(input)[r]);
+				break;
+			}
+		}
+		load_data_writer.FinishRow();
+	}
+	if (load_data_writer.Size() >= load_data_flush_size) {
+		FlushLoadData(con);
+	}
+}
+
+void MySQLInsertBuffer::AppendInsert(MySQLConnection &con, DataChunk &chunk) {
+	char buffer[MySQLColumnWriter::MAX_FORMATTED_SIZE];
+	// generate INSERT INTO statements
+	for (idx_t r = 0; r < chunk.size(); r++) {
+		if (insert_query.size() > base_insert_size) {
+			insert_query += ", ";
+		}
+		insert_query += '(';
+		for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+			if (c > 0) {
+				insert_query += ", ";
+			}
+			auto &writer = column_writers[c];
+			auto &input = GetInput(chunk, c);
+			if (FlatVector::IsNull(input, r)) {
+				insert_query += "NULL";
+				continue;
+			}
+			switch (writer.format) {
+			case MySQLColumnFormat::FORMATTED: {
+				auto length = writer.format_value(writer, input, r, buffer);
+				if (writer.quote) {
+					// formatted values contain no characters that need to be escaped
+					insert_query += '\'';
+					insert_query.append(buffer, length);
+					insert_query += '\'';
+				} else {
+					insert_query.append(buffer, length);
+				}
+				break;
+			}
+			case MySQLColumnFormat::FLOAT: {
+				auto text = StringCast::Operation<float>(FlatVector::GetData<float>(input)[r], string_heap);
+				insert_query.append(text.GetData(), text.GetSize());
+				break;
+			}
+			case MySQLColumnFormat::DOUBLE: {
+				auto text = StringCast::Operation<double>(FlatVector::GetData<double>(input)[r], string_heap);
+				insert_query.append(text.GetData(), text.GetSize());
+				break;
+			}
+			case MySQLColumnFormat::BLOB: {
+				auto &value = FlatVector::GetData<string_t>(input)[r];
+				WriteHexLiteral(insert_query, const_data_ptr_cast(value.GetData()), value.GetSize());
+				break;
+			}
+			default: {
+				auto &value = FlatVector::GetData<string_t>(input)[r];
+				WriteEscapedLiteral(insert_query, value.GetData(), value.GetSize());
+				break;
+			}
+			}
+		}
+		insert_query += ')';
+		if (insert_query.size() - base_insert_size >= batch_size.Get()) {
+			// perform the actual insert
+			FlushInsert(con);
+		}
+	}
+}
+
+string GetLoadDataQuery(const string &table_name, const vector<string> &column_names, bool replace) {
+	// the file name is ignored - the data is fed from memory (see MySQLConnection::LoadData)
+	string query;
+	query += "LOAD DATA LOCAL INFILE 'duckdb_insert' ";
+	if (replace) {
+		query += "REPLACE ";
+	}
+	query += "INTO TABLE ";
+	query += table_name;
+	query += " CHARACTER SET utf8mb4";
+	if (!column_names.empty()) {
+		query += " (";
+		for (idx_t c = 0; c < column_names.size(); c++) {
+			if (c > 0) {
+				query += ", ";
+			}
+			query += MySQLUtils::WriteIdentifier(column_names[c]);
+		}
+		query += ")";
+	}
+	return query;
+}
+
+} // namespace duckdb
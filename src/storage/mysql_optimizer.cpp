@@ -1,7 +1,28 @@
 #include "storage/mysql_optimizer.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_sample.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
+#include "mysql_cached_tables.hpp"
+#include "mysql_filter_pushdown.hpp"
 #include "mysql_scanner.hpp"
+#include "storage/mysql_catalog.hpp"
+#include "storage/mysql_table_entry.hpp"
+#include "storage/mysql_transaction.hpp"
 
 namespace duckdb {
 
@@ -9,55 +30,853 @@ static bool IsMySQLScan(const string &function_name) {
 	return function_name == "mysql_scan";
 }
 
-void OptimizeMySQLScan(unique_ptr<LogicalOperator> &op) {
-	if (op->type == LogicalOperatorType::LOGICAL_LIMIT) {
-		auto &limit = op->Cast<LogicalLimit>();
-		reference<LogicalOperator> child = *op->children[0];
-		while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
-			child = *child.get().children[0];
+static bool UseAggregatePushdown(ClientContext &context) {
+	Value aggregate_pushdown;
+	if (!context.TryGetCurrentSetting("mysql_aggregate_pushdown", aggregate_pushdown)) {
+		return false;
+	}
+	return BooleanValue::Get(aggregate_pushdown);
+}
+
+static bool UseOrderedScan(ClientContext &context) {
+	Value ordered_scan;
+	if (!context.TryGetCurrentSetting("mysql_ordered_scan", ordered_scan)) {
+		return true;
+	}
+	// the rows only arrive in the order in which they are read if DuckDB preserves the insertion order
+	return BooleanValue::Get(ordered_scan) && DBConfig::GetConfig(context).options.preserve_insertion_order;
+}
+
+static bool UseSamplePushdown(ClientContext &context) {
+	Value sample_pushdown;
+	if (!context.TryGetCurrentSetting("mysql_sample_pushdown", sample_pushdown)) {
+		return true;
+	}
+	return BooleanValue::Get(sample_pushdown);
+}
+
+static bool UseJoinPushdown(ClientContext &context) {
+	Value join_pushdown;
+	if (!context.TryGetCurrentSetting("mysql_join_pushdown", join_pushdown)) {
+		return false;
+	}
+	return BooleanValue::Get(join_pushdown);
+}
+
+static bool UseCachedTables(ClientContext &context) {
+	Value use_cached_tables;
+	if (!context.TryGetCurrentSetting("mysql_use_cached_tables", use_cached_tables)) {
+		return true;
+	}
+	return BooleanValue::Get(use_cached_tables);
+}
+
+static optional_ptr<LogicalGet> GetMySQLScan(LogicalOperator &op) {
+	if (op.type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = op.Cast<LogicalGet>();
+	if (!IsMySQLScan(get.function.name)) {
+		return nullptr;
+	}
+	return &get;
+}
+
+static string GetColumnAlias(idx_t column_index) {
+	return MySQLUtils::WriteIdentifier("c" + to_string(column_index));
+}
+
+static string GetTableName(const MySQLBindData &bind_data) {
+	return MySQLUtils::WriteIdentifier(bind_data.table.schema.name) + "." +
+	       MySQLUtils::WriteIdentifier(bind_data.table.name);
+}
+
+//! Returns the WHERE clause for the filters and filter expressions that have been pushed into a scan of a MySQL table
+static string GetFilterString(LogicalGet &get) {
+	auto &bind_data = get.bind_data->Cast<MySQLBindData>();
+	vector<column_t> column_ids;
+	for (auto &column_id : get.GetColumnIds()) {
+		column_ids.push_back(column_id.IsRowIdColumn() ? COLUMN_IDENTIFIER_ROW_ID : column_id.GetPrimaryIndex());
+	}
+	auto result = MySQLFilterPushdown::TransformFilters(column_ids, &get.table_filters, bind_data.names);
+	if (!bind_data.filter.empty()) {
+		result = result.empty() ? bind_data.filter : result + " AND " + bind_data.filter;
+	}
+	return result;
+}
+
+//! Replaces a scan of a MySQL table with a query - the columns of the query have to be named c0, c1, ...
+static void ReplaceScanWithQuery(LogicalGet &get, string query, vector<string> names, vector<LogicalType> types) {
+	auto &bind_data = get.bind_data->Cast<MySQLBindData>();
+	bind_data.query = std::move(query);
+	bind_data.filter.clear();
+	bind_data.order_by.clear();
+	bind_data.limit.clear();
+	bind_data.limit_rows = optional_idx();
+	bind_data.names = names;
+	bind_data.types = types;
+	get.names = std::move(names);
+	get.returned_types = std::move(types);
+	auto &column_ids = get.GetMutableColumnIds();
+	column_ids.clear();
+	for (idx_t i = 0; i < get.returned_types.size(); i++) {
+		column_ids.emplace_back(i);
+	}
+	get.projection_ids.clear();
+	get.table_filters.filters.clear();
+}
+
+struct MySQLPushdownColumn {
+	string name;
+	LogicalType type;
+};
+
+static bool GetPushdownColumn(LogicalGet &get, const Expression &expr, MySQLPushdownColumn &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto &colref = expr.Cast<BoundColumnRefExpression>();
+	if (colref.depth > 0 || colref.binding.table_index != get.table_index) {
+		return false;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (colref.binding.column_index >= column_ids.size()) {
+		return false;
+	}
+	auto &column_id = column_ids[colref.binding.column_index];
+	if (column_id.IsRowIdColumn()) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<MySQLBindData>();
+	result.name = bind_data.names[column_id.GetPrimaryIndex()];
+	result.type = bind_data.types[column_id.GetPrimaryIndex()];
+	return true;
+}
+
+static bool CanCompareInMySQL(const LogicalType &type) {
+	// only numbers are grouped and compared identically in MySQL and DuckDB
+	// strings are subject to the collation of the column, and MySQL "zero" dates are read as NULL by DuckDB
+	return type.IsNumeric();
+}
+
+static bool CanCountInMySQL(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		// "zero" dates are not NULL in MySQL - but they are read as NULL by DuckDB
+		return false;
+	default:
+		return true;
+	}
+}
+
+static bool TransformAggregate(LogicalGet &get, const Expression &expr, string &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+		return false;
+	}
+	auto &aggr = expr.Cast<BoundAggregateExpression>();
+	if (aggr.IsDistinct() || aggr.filter || aggr.order_bys) {
+		return false;
+	}
+	auto &name = aggr.function.name;
+	if (name == "count_star") {
+		result = "COUNT(*)";
+		return true;
+	}
+	if (aggr.children.size() != 1) {
+		return false;
+	}
+	MySQLPushdownColumn column;
+	if (!GetPushdownColumn(get, *aggr.children[0], column)) {
+		return false;
+	}
+	auto column_name = MySQLUtils::WriteIdentifier(column.name);
+	if (name == "count") {
+		if (!CanCountInMySQL(column.type)) {
+			return false;
+		}
+		result = "COUNT(" + column_name + ")";
+		return true;
+	}
+	if (!CanCompareInMySQL(column.type)) {
+		return false;
+	}
+	if (name == "sum" || name == "min" || name == "max") {
+		result = StringUtil::Upper(name) + "(" + column_name + ")";
+		return true;
+	}
+	return false;
+}
+
+static unique_ptr<Expression> BindFirstAggregate(ClientContext &context, unique_ptr<Expression> child) {
+	auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA, "first");
+	FunctionBinder function_binder(context);
+	ErrorData error;
+	auto best_function = function_binder.BindFunction(func.name, func.functions, {child->return_type}, error);
+	if (!best_function.IsValid()) {
+		error.Throw();
+	}
+	auto first_function = func.functions.GetFunctionByOffset(best_function.GetIndex());
+	vector<unique_ptr<Expression>> children;
+	children.push_back(std::move(child));
+	return function_binder.BindAggregateFunction(std::move(first_function), std::move(children));
+}
+
+//! Removes the dynamic join filters that target a scan - the scan is about to be replaced
+static void RemoveDynamicFilterTargets(LogicalOperator &op, LogicalGet &get) {
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		if (join.filter_pushdown) {
+			vector<PushdownFilterTarget> remaining_targets;
+			for (auto &target : join.filter_pushdown->probe_info) {
+				if (&target.get != &get) {
+					remaining_targets.push_back(std::move(target));
+				}
+			}
+			join.filter_pushdown->probe_info = std::move(remaining_targets);
+			if (join.filter_pushdown->probe_info.empty()) {
+				join.filter_pushdown.reset();
+			}
+		}
+	}
+	for (auto &child : op.children) {
+		RemoveDynamicFilterTargets(*child, get);
+	}
+}
+
+//! Pushes a GROUP BY with simple aggregates directly on top of a MySQL table scan into MySQL
+//! The scan is replaced by the aggregate query, and the aggregate is kept to pick the (single) row of each group
+static void TryPushdownAggregate(ClientContext &context, LogicalOperator &plan, LogicalOperator &op) {
+	auto &aggr = op.Cast<LogicalAggregate>();
+	if (aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		return;
+	}
+	auto get_ptr = GetMySQLScan(*aggr.children[0]);
+	if (!get_ptr) {
+		return;
+	}
+	auto &get = *get_ptr;
+	auto &bind_data = get.bind_data->Cast<MySQLBindData>();
+	if (!bind_data.limit.empty() || !bind_data.query.empty()) {
+		// the aggregate needs to be computed over the limited result
+		return;
+	}
+	vector<string> select_list;
+	vector<string> group_list;
+	vector<string> new_names;
+	vector<LogicalType> new_types;
+	for (auto &group : aggr.groups) {
+		MySQLPushdownColumn column;
+		if (!GetPushdownColumn(get, *group, column) || !CanCompareInMySQL(column.type)) {
+			return;
+		}
+		auto column_name = MySQLUtils::WriteIdentifier(column.name);
+		select_list.push_back(column_name + " AS " + GetColumnAlias(select_list.size()));
+		group_list.push_back(column_name);
+		new_names.push_back(column.name);
+		new_types.push_back(column.type);
+	}
+	for (auto &expr : aggr.expressions) {
+		string aggregate;
+		if (!TransformAggregate(get, *expr, aggregate)) {
+			return;
+		}
+		select_list.push_back(aggregate + " AS " + GetColumnAlias(select_list.size()));
+		new_names.push_back(expr->GetName());
+		new_types.push_back(expr->return_type);
+	}
+	// generate the aggregate query
+	string query = "SELECT " + StringUtil::Join(select_list, ", ");
+	query += " FROM " + GetTableName(bind_data);
+	auto filter_string = GetFilterString(get);
+	if (!filter_string.empty()) {
+		query += " WHERE " + filter_string;
+	}
+	if (!group_list.empty()) {
+		query += " GROUP BY " + StringUtil::Join(group_list, ", ");
+	}
+
+	// the scan now returns the result of the aggregate query
+	RemoveDynamicFilterTargets(plan, get);
+	ReplaceScanWithQuery(get, std::move(query), std::move(new_names), std::move(new_types));
+
+	// every group occurs exactly once in the result - so the aggregates only have to pick the pushed down values
+	for (idx_t i = 0; i < aggr.groups.size(); i++) {
+		auto &type = get.returned_types[i];
+		aggr.groups[i] = make_uniq<BoundColumnRefExpression>(type, ColumnBinding(get.table_index, i));
+	}
+	for (idx_t i = 0; i < aggr.expressions.size(); i++) {
+		auto column_index = aggr.groups.size() + i;
+		auto &type = get.returned_types[column_index];
+		auto colref = make_uniq<BoundColumnRefExpression>(type, ColumnBinding(get.table_index, column_index));
+		auto alias = aggr.expressions[i]->alias;
+		aggr.expressions[i] = BindFirstAggregate(context, std::move(colref));
+		aggr.expressions[i]->alias = std::move(alias);
+	}
+}
+
+static void TryPushdownLimit(unique_ptr<LogicalOperator> &op) {
+	auto &limit = op->Cast<LogicalLimit>();
+	reference<LogicalOperator> child = *op->children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		child = *child.get().children[0];
+	}
+	auto get = GetMySQLScan(child.get());
+	if (!get) {
+		return;
+	}
+	switch (limit.limit_val.Type()) {
+	case LimitNodeType::CONSTANT_VALUE:
+	case LimitNodeType::UNSET:
+		break;
+	default:
+		// not a constant or unset limit
+		return;
+	}
+	switch (limit.offset_val.Type()) {
+	case LimitNodeType::CONSTANT_VALUE:
+	case LimitNodeType::UNSET:
+		break;
+	default:
+		// not a constant or unset offset
+		return;
+	}
+	auto &bind_data = get->bind_data->Cast<MySQLBindData>();
+	if (!bind_data.limit.empty() || !bind_data.order_by.empty()) {
+		// the scan is already limited
+		return;
+	}
+	if (limit.limit_val.Type() != LimitNodeType::UNSET) {
+		bind_data.limit += " LIMIT " + to_string(limit.limit_val.GetConstantValue());
+		bind_data.limit_rows = limit.limit_val.GetConstantValue();
+	}
+	if (limit.offset_val.Type() != LimitNodeType::UNSET) {
+		bind_data.limit += " OFFSET " + to_string(limit.offset_val.GetConstantValue());
+	}
+	// remove the limit
+	op = std::move(op->children[0]);
+}
+
+//! Pushes a sample over a MySQL scan into MySQL, so that only the sampled rows are transferred
+//! Percentage samples (system and bernoulli) become a WHERE RAND() < fraction, which picks every row with the same
+//! probability - fixed size (reservoir) samples become ORDER BY RAND() LIMIT n
+static void TryPushdownSample(unique_ptr<LogicalOperator> &op) {
+	auto &sample = op->Cast<LogicalSample>();
+	reference<LogicalOperator> child = *op->children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		child = *child.get().children[0];
+	}
+	auto get = GetMySQLScan(child.get());
+	if (!get) {
+		return;
+	}
+	auto &bind_data = get->bind_data->Cast<MySQLBindData>();
+	if (!bind_data.query.empty() || !bind_data.limit.empty() || !bind_data.order_by.empty() || bind_data.sampled) {
+		return;
+	}
+	auto &options = *sample.sample_options;
+	auto random = options.seed.IsValid() ? "RAND(" + to_string(options.seed.GetIndex()) + ")" : string("RAND()");
+	if (options.is_percentage) {
+		if (options.method == SampleMethod::RESERVOIR_SAMPLE) {
+			// reservoir samples have an exact size
+			return;
+		}
+		auto fraction = options.sample_size.GetValue<double>() / 100.0;
+		auto condition = random + " < " + Value::DOUBLE(fraction).ToString();
+		bind_data.filter = bind_data.filter.empty() ? condition : bind_data.filter + " AND " + condition;
+	} else {
+		auto sample_size = options.sample_size.GetValue<int64_t>();
+		bind_data.order_by = " ORDER BY " + random;
+		bind_data.limit = " LIMIT " + to_string(sample_size);
+		bind_data.limit_rows = NumericCast<idx_t>(sample_size);
+	}
+	bind_data.sampled = true;
+	bind_data.seeded_sample = options.seed.IsValid();
+	// remove the sample
+	op = std::move(op->children[0]);
+}
+
+static bool IsNullable(const MySQLTableEntry &table, idx_t column_index) {
+	for (auto &constraint : table.GetConstraints()) {
+		if (constraint->type != ConstraintType::NOT_NULL) {
+			continue;
+		}
+		auto &not_null = constraint->Cast<NotNullConstraint>();
+		if (not_null.index.index == column_index) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Transforms an ORDER BY node over a MySQL scan into an ORDER BY clause that sorts the rows in the same order
+static bool TransformOrder(LogicalGet &get, idx_t column_index, const BoundOrderByNode &order, string &result) {
+	auto &bind_data = get.bind_data->Cast<MySQLBindData>();
+	auto &column_id = get.GetColumnIds()[column_index];
+	if (column_id.IsRowIdColumn()) {
+		return false;
+	}
+	string column_name;
+	LogicalType type;
+	bool nullable;
+	if (!bind_data.query.empty()) {
+		column_name = GetColumnAlias(column_index);
+		type = bind_data.types[column_index];
+		nullable = true;
+	} else {
+		column_name = MySQLUtils::WriteIdentifier(bind_data.names[column_id.GetPrimaryIndex()]);
+		type = bind_data.types[column_id.GetPrimaryIndex()];
+		nullable = IsNullable(bind_data.table, column_id.GetPrimaryIndex());
+	}
+	auto descending = order.type == OrderType::DESCENDING;
+	auto nulls_first = order.null_order == OrderByNullType::NULLS_FIRST;
+	// MySQL sorts NULL values before all other values
+	auto native_null_order = descending != nulls_first;
+	switch (type.id()) {
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		// "zero" dates are read as NULL by DuckDB, but are sorted right after NULL values by MySQL
+		// the same rows end up at the top only if NULL values are sorted as MySQL does
+		if (!native_null_order) {
+			return false;
+		}
+		break;
+	default:
+		if (!CanCompareInMySQL(type)) {
+			return false;
+		}
+		break;
+	}
+	result = string();
+	if (!native_null_order && nullable) {
+		if (!bind_data.query.empty()) {
+			// the aliases of a query cannot be used in expressions in the ORDER BY clause
+			return false;
+		}
+		result += column_name + (nulls_first ? " IS NULL DESC, " : " IS NULL, ");
+	}
+	result += column_name + (descending ? " DESC" : " ASC");
+	return true;
+}
+
+//! Pushes the expressions of a filter directly on top of a MySQL scan into the WHERE clause of the scan
+//! Expressions that cannot be (exactly) evaluated by MySQL are kept in the filter
+static void TryPushdownFilter(unique_ptr<LogicalOperator> &op) {
+	auto &filter = op->Cast<LogicalFilter>();
+	auto get = GetMySQLScan(*filter.children[0]);
+	if (!get || !get->function.filter_pushdown) {
+		return;
+	}
+	auto &bind_data = get->bind_data->Cast<MySQLBindData>();
+	if (!bind_data.query.empty() || !bind_data.limit.empty() || !bind_data.order_by.empty()) {
+		// filters cannot be pushed below a limit
+		return;
+	}
+	vector<string> column_names;
+	for (auto &column_id : get->GetColumnIds()) {
+		if (column_id.IsRowIdColumn()) {
+			column_names.emplace_back();
+		} else {
+			column_names.push_back(MySQLUtils::WriteIdentifier(bind_data.names[column_id.GetPrimaryIndex()]));
+		}
+	}
+	vector<string> conditions;
+	vector<unique_ptr<Expression>> remaining_expressions;
+	for (auto &expr : filter.expressions) {
+		string condition;
+		bool exact = true;
+		if (!MySQLFilterPushdown::TransformExpression(*expr, get->table_index, column_names, condition, exact)) {
+			remaining_expressions.push_back(std::move(expr));
+			continue;
 		}
-		if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		conditions.push_back(std::move(condition));
+		if (!exact) {
+			remaining_expressions.push_back(std::move(expr));
+		}
+	}
+	filter.expressions = std::move(remaining_expressions);
+	if (conditions.empty()) {
+		return;
+	}
+	if (!bind_data.filter.empty()) {
+		conditions.insert(conditions.begin(), bind_data.filter);
+	}
+	bind_data.filter = StringUtil::Join(conditions, " AND ");
+	if (filter.expressions.empty() && filter.projection_map.empty()) {
+		// the entire filter has been pushed down
+		op = std::move(op->children[0]);
+	}
+}
+
+//! Pushes a Top-N over a MySQL scan into MySQL as an ORDER BY ... LIMIT
+//! The Top-N is kept, so that the final order is determined by DuckDB
+static void TryPushdownTopN(LogicalOperator &op) {
+	auto &top_n = op.Cast<LogicalTopN>();
+	vector<ColumnBinding> bindings;
+	for (auto &order : top_n.orders) {
+		if (order.expression->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
 			return;
 		}
-		auto &get = child.get().Cast<LogicalGet>();
-		if (!IsMySQLScan(get.function.name)) {
+		bindings.push_back(order.expression->Cast<BoundColumnRefExpression>().binding);
+	}
+	// resolve the ordered columns through any projections
+	reference<LogicalOperator> child = *op.children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &projection = child.get().Cast<LogicalProjection>();
+		for (auto &binding : bindings) {
+			if (binding.table_index != projection.table_index) {
+				return;
+			}
+			auto &expr = *projection.expressions[binding.column_index];
+			if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+		}
+		child = *child.get().children[0];
+	}
+	auto get = GetMySQLScan(child.get());
+	if (!get) {
+		return;
+	}
+	auto &bind_data = get->bind_data->Cast<MySQLBindData>();
+	if (!bind_data.limit.empty() || !bind_data.order_by.empty()) {
+		return;
+	}
+	vector<string> orders;
+	for (idx_t i = 0; i < top_n.orders.size(); i++) {
+		auto &binding = bindings[i];
+		if (binding.table_index != get->table_index || binding.column_index >= get->GetColumnIds().size()) {
+			return;
+		}
+		string order;
+		if (!TransformOrder(*get, binding.column_index, top_n.orders[i], order)) {
 			return;
 		}
-		switch (limit.limit_val.Type()) {
-		case LimitNodeType::CONSTANT_VALUE:
-		case LimitNodeType::UNSET:
+		orders.push_back(std::move(order));
+	}
+	bind_data.order_by = " ORDER BY " + StringUtil::Join(orders, ", ");
+	bind_data.limit = " LIMIT " + to_string(top_n.limit + top_n.offset);
+	bind_data.limit_rows = top_n.limit + top_n.offset;
+}
+
+//! Replaces an ORDER BY the primary key of a MySQL table by a scan that reads the table in primary key order - which
+//! InnoDB answers by walking its clustered index. The rows are then emitted in that order (including the partitions of
+//! parallel scans), so that DuckDB does not need to sort them. This is only done for numeric keys, which are ordered
+//! identically by MySQL and DuckDB.
+static void TryPushdownOrder(unique_ptr<LogicalOperator> &op) {
+	auto &order = op->Cast<LogicalOrder>();
+	if (!order.projection_map.empty()) {
+		return;
+	}
+	vector<ColumnBinding> bindings;
+	for (auto &order_node : order.orders) {
+		if (order_node.expression->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
 			break;
-		default:
-			// not a constant or unset limit
+		}
+		bindings.push_back(order_node.expression->Cast<BoundColumnRefExpression>().binding);
+	}
+	// resolve the ordered columns through any projections - filters keep the order (and the bindings) of their input
+	reference<LogicalOperator> child = *op->children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION ||
+	       child.get().type == LogicalOperatorType::LOGICAL_FILTER) {
+		if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &projection = child.get().Cast<LogicalProjection>();
+			for (auto &binding : bindings) {
+				if (binding.table_index != projection.table_index) {
+					return;
+				}
+				auto &expr = *projection.expressions[binding.column_index];
+				if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+					return;
+				}
+				binding = expr.Cast<BoundColumnRefExpression>().binding;
+			}
+		}
+		child = *child.get().children[0];
+	}
+	auto get = GetMySQLScan(child.get());
+	if (!get) {
+		return;
+	}
+	auto &bind_data = get->bind_data->Cast<MySQLBindData>();
+	if (!bind_data.query.empty() || !bind_data.limit.empty() || !bind_data.order_by.empty() || bind_data.sampled) {
+		return;
+	}
+	auto &primary_key = bind_data.table.primary_key;
+	// the ordered columns have to start with the primary key, or be a prefix of it - since the key is unique, any
+	// columns after it do not affect the order
+	auto key_columns = MinValue<idx_t>(order.orders.size(), primary_key.size());
+	if (key_columns == 0 || bindings.size() < key_columns) {
+		return;
+	}
+	auto order_type = order.orders[0].type;
+	auto &column_ids = get->GetColumnIds();
+	for (idx_t i = 0; i < key_columns; i++) {
+		auto &binding = bindings[i];
+		if (binding.table_index != get->table_index || binding.column_index >= column_ids.size() ||
+		    column_ids[binding.column_index].IsRowIdColumn() || order.orders[i].type != order_type) {
+			return;
+		}
+		auto column_index = column_ids[binding.column_index].GetPrimaryIndex();
+		if (!StringUtil::CIEquals(bind_data.names[column_index], primary_key[i]) ||
+		    !CanCompareInMySQL(bind_data.types[column_index])) {
+			return;
+		}
+	}
+	auto direction = order_type == OrderType::DESCENDING ? " DESC" : " ASC";
+	vector<string> orders;
+	for (auto &column_name : primary_key) {
+		orders.push_back(MySQLUtils::WriteIdentifier(column_name) + direction);
+	}
+	bind_data.order_by = " ORDER BY " + StringUtil::Join(orders, ", ");
+	bind_data.primary_key_order = order_type == OrderType::DESCENDING ? OrderType::DESCENDING : OrderType::ASCENDING;
+	// remove the order
+	op = std::move(op->children[0]);
+}
+
+//! Returns a query that produces the output of a MySQL scan, with column i of the scan named c<i>
+static string GetScanSubquery(LogicalGet &get) {
+	auto &bind_data = get.bind_data->Cast<MySQLBindData>();
+	string result;
+	if (!bind_data.query.empty()) {
+		// the columns of the query already correspond to the columns of the scan
+		result = bind_data.query;
+	} else {
+		auto &column_ids = get.GetColumnIds();
+		// the row id is the (integer) primary key, as in regular scans - DELETE and UPDATE statements that are
+		// executed in batches identify the rows to modify by their row id
+		auto row_id_column = bind_data.table.GetRowIdColumn();
+		vector<string> select_list;
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			string column;
+			if (column_ids[i].IsRowIdColumn()) {
+				column = row_id_column.empty() ? "NULL" : MySQLUtils::WriteIdentifier(row_id_column);
+			} else {
+				column = MySQLUtils::WriteIdentifier(bind_data.names[column_ids[i].GetPrimaryIndex()]);
+			}
+			select_list.push_back(column + " AS " + GetColumnAlias(i));
+		}
+		result = "SELECT " + StringUtil::Join(select_list, ", ") + " FROM " + GetTableName(bind_data);
+		auto filter_string = GetFilterString(get);
+		if (!filter_string.empty()) {
+			result += " WHERE " + filter_string;
+		}
+	}
+	result += bind_data.order_by;
+	result += bind_data.limit;
+	return result;
+}
+
+static string GetScanColumnName(LogicalGet &get, idx_t column_index) {
+	auto &bind_data = get.bind_data->Cast<MySQLBindData>();
+	auto &column_id = get.GetColumnIds()[column_index];
+	if (column_id.IsRowIdColumn()) {
+		return "rowid";
+	}
+	return bind_data.names[column_id.GetPrimaryIndex()];
+}
+
+static bool GetJoinColumn(LogicalGet &get, const Expression &expr, const string &table_alias, string &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto &colref = expr.Cast<BoundColumnRefExpression>();
+	if (colref.depth > 0 || colref.binding.table_index != get.table_index) {
+		return false;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (colref.binding.column_index >= column_ids.size() || column_ids[colref.binding.column_index].IsRowIdColumn()) {
+		return false;
+	}
+	if (!CanCompareInMySQL(colref.return_type)) {
+		return false;
+	}
+	result = table_alias + "." + GetColumnAlias(colref.binding.column_index);
+	return true;
+}
+
+//! Pushes an inner join between two scans of the same attached MySQL database into MySQL
+//! The join is replaced by a single scan that runs the join query
+static void TryPushdownJoin(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan,
+                            unique_ptr<LogicalOperator> &op) {
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || join.conditions.empty()) {
+		return;
+	}
+	auto left = GetMySQLScan(*join.children[0]);
+	auto right = GetMySQLScan(*join.children[1]);
+	if (!left || !right) {
+		return;
+	}
+	auto &left_bind_data = left->bind_data->Cast<MySQLBindData>();
+	auto &right_bind_data = right->bind_data->Cast<MySQLBindData>();
+	if (&left_bind_data.table.catalog != &right_bind_data.table.catalog) {
+		return;
+	}
+	if (left_bind_data.sampled || right_bind_data.sampled) {
+		// MySQL could evaluate the random condition of a sample per row of the join, instead of per row of the table
+		return;
+	}
+	vector<string> conditions;
+	for (auto &condition : join.conditions) {
+		string left_column;
+		string right_column;
+		if (!GetJoinColumn(*left, *condition.left, "l", left_column) ||
+		    !GetJoinColumn(*right, *condition.right, "r", right_column)) {
 			return;
 		}
-		switch (limit.offset_val.Type()) {
-		case LimitNodeType::CONSTANT_VALUE:
-		case LimitNodeType::UNSET:
+		switch (condition.comparison) {
+		case ExpressionType::COMPARE_EQUAL:
+			conditions.push_back(left_column + " = " + right_column);
+			break;
+		case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+			conditions.push_back(left_column + " <=> " + right_column);
 			break;
 		default:
-			// not a constant or unset offset
 			return;
 		}
-		auto &bind_data = get.bind_data->Cast<MySQLBindData>();
-		if (limit.limit_val.Type() != LimitNodeType::UNSET) {
-			bind_data.limit += " LIMIT " + to_string(limit.limit_val.GetConstantValue());
-		}
-		if (limit.offset_val.Type() != LimitNodeType::UNSET) {
-			bind_data.limit += " OFFSET " + to_string(limit.offset_val.GetConstantValue());
+	}
+	join.ResolveOperatorTypes();
+	auto bindings = join.GetColumnBindings();
+	if (bindings.empty()) {
+		return;
+	}
+	vector<string> select_list;
+	vector<string> names;
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		auto &binding = bindings[i];
+		auto is_left = binding.table_index == left->table_index;
+		auto &get = is_left ? *left : *right;
+		select_list.push_back(string(is_left ? "l." : "r.") + GetColumnAlias(binding.column_index) + " AS " +
+		                      GetColumnAlias(i));
+		names.push_back(GetScanColumnName(get, binding.column_index));
+	}
+	// generate the join query
+	string query = "SELECT " + StringUtil::Join(select_list, ", ");
+	query += " FROM (" + GetScanSubquery(*left) + ") AS l";
+	query += " INNER JOIN (" + GetScanSubquery(*right) + ") AS r";
+	query += " ON " + StringUtil::Join(conditions, " AND ");
+
+	// replace the join with the left scan, which now runs the join query
+	RemoveDynamicFilterTargets(*plan, *left);
+	RemoveDynamicFilterTargets(*plan, *right);
+	auto types = join.types;
+	auto estimated_cardinality = join.estimated_cardinality;
+	auto has_estimated_cardinality = join.has_estimated_cardinality;
+	auto scan = std::move(join.children[0]);
+	auto &get = scan->Cast<LogicalGet>();
+	ReplaceScanWithQuery(get, std::move(query), std::move(names), std::move(types));
+	get.table_index = input.optimizer.binder.GenerateTableIndex();
+	get.estimated_cardinality = estimated_cardinality;
+	get.has_estimated_cardinality = has_estimated_cardinality;
+	op = std::move(scan);
+
+	// operators above the join now have to reference the columns of the scan
+	ColumnBindingReplacer replacer;
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		replacer.replacement_bindings.emplace_back(bindings[i], ColumnBinding(get.table_index, i));
+	}
+	replacer.stop_operator = op.get();
+	replacer.VisitOperator(*plan);
+}
+
+//! Whether or not the plan deletes or updates rows - these are identified by the row ids read from MySQL
+static bool HasModification(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_DELETE || op.type == LogicalOperatorType::LOGICAL_UPDATE) {
+		return true;
+	}
+	for (auto &child : op.children) {
+		if (HasModification(*child)) {
+			return true;
 		}
-		// remove the limit
-		op = std::move(op->children[0]);
+	}
+	return false;
+}
+
+//! Replaces the scans of tables that are cached locally (see mysql_cache_table) with scans of the local copy
+static void ReplaceCachedScans(ClientContext &context, LogicalOperator &op) {
+	for (auto &child : op.children) {
+		ReplaceCachedScans(context, *child);
+	}
+	auto get = GetMySQLScan(op);
+	if (!get) {
+		return;
+	}
+	auto &bind_data = get->bind_data->Cast<MySQLBindData>();
+	if (!bind_data.query.empty() || !bind_data.filter.empty() || !bind_data.order_by.empty() ||
+	    !bind_data.limit.empty() || !bind_data.watermark_column.empty() || bind_data.sampled) {
 		return;
 	}
-	// recurse into children
+	auto &table = bind_data.table;
+	auto &catalog = table.catalog.Cast<MySQLCatalog>();
+	auto cached_table = catalog.GetCachedTables().Find(table.schema.name, table.name);
+	// the copy holds the committed rows - a transaction that has written to MySQL has to read its own writes
+	if (!cached_table || !MySQLTransaction::CanUseSeparateConnection(context, catalog)) {
+		return;
+	}
+	auto data = cached_table->GetData(context, catalog);
+	if (data->types != bind_data.types) {
+		// the table has been altered since it was read - until the copy is refreshed the table is read from MySQL
+		return;
+	}
+	get->function = MySQLCachedScanFunction();
+	get->bind_data = make_uniq<MySQLCachedScanBindData>(table, std::move(data));
+}
+
+static void OptimizeMySQLScan(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan,
+                              unique_ptr<LogicalOperator> &op) {
+	// recurse into children first - so that joins have been replaced by scans before pushing operators into them
 	for (auto &child : op->children) {
-		OptimizeMySQLScan(child);
+		OptimizeMySQLScan(input, plan, child);
+	}
+	switch (op->type) {
+	case LogicalOperatorType::LOGICAL_FILTER:
+		// DELETE and UPDATE statements that are not batched are rewritten into SQL from the physical filters and
+		// table filters of the plan - filters pushed into the scan would be dropped from the WHERE clause
+		if (!HasModification(*plan)) {
+			TryPushdownFilter(op);
+		}
+		break;
+	case LogicalOperatorType::LOGICAL_LIMIT:
+		TryPushdownLimit(op);
+		break;
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+		if (UseOrderedScan(input.context)) {
+			TryPushdownOrder(op);
+		}
+		break;
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		if (UseSamplePushdown(input.context)) {
+			TryPushdownSample(op);
+		}
+		break;
+	case LogicalOperatorType::LOGICAL_TOP_N:
+		TryPushdownTopN(*op);
+		break;
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		if (UseAggregatePushdown(input.context)) {
+			TryPushdownAggregate(input.context, *plan, *op);
+		}
+		break;
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		if (UseJoinPushdown(input.context)) {
+			TryPushdownJoin(input, plan, op);
+		}
+		break;
+	default:
+		break;
 	}
 }
 
 void MySQLOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
-	OptimizeMySQLScan(plan);
+	if (UseCachedTables(input.context) && !HasModification(*plan)) {
+		// before anything is pushed into MySQL - the cached scans evaluate filters (and aggregates) locally
+		ReplaceCachedScans(input.context, *plan);
+	}
+	OptimizeMySQLScan(input, plan, plan);
 }
 
 } // namespace duckdb
@@ -0,0 +1,143 @@
+#include "storage/mysql_schema_cache.hpp"
+#include "storage/mysql_catalog.hpp"
+#include "storage/mysql_transaction.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+
+namespace duckdb {
+
+static constexpr const char *MYSQL_SCHEMA_CACHE_MAGIC = "DUCKDB_MYSQL_SCHEMA_CACHE";
+static constexpr const uint32_t MYSQL_SCHEMA_CACHE_VERSION = 1;
+
+MySQLSchemaCache::MySQLSchemaCache(ClientContext &context, MySQLCatalog &catalog, const string &schema_name_p)
+    : context(context), catalog(catalog), schema_name(schema_name_p) {
+	Value cache_path;
+	if (!context.TryGetCurrentSetting("mysql_schema_cache_path", cache_path) || cache_path.IsNull()) {
+		return;
+	}
+	auto directory = cache_path.ToString();
+	if (directory.empty()) {
+		return;
+	}
+	auto key = catalog.connection_string + "\n" + schema_name;
+	auto &fs = FileSystem::GetFileSystem(context);
+	path = fs.JoinPath(directory, "mysql_schema_" + to_string(Hash(key.c_str())) + ".cache");
+}
+
+string MySQLSchemaCache::GetFingerprint() {
+	// tables that are created, dropped, renamed or rebuilt by ALTER TABLE change the fingerprint - as do columns that
+	// are added or dropped without rebuilding the table (e.g. through ALGORITHM=INSTANT), which keeps its create_time
+	// the columns are only counted, so that the fingerprint stays cheap to compute for schemas with many columns
+	auto query = StringUtil::Replace(R"(
+SELECT CONCAT(COUNT(*), ':', COALESCE(BIT_XOR(CRC32(CONCAT_WS(':', table_name, table_type, create_time))), 0), ':',
+	(SELECT COUNT(*) FROM information_schema.columns WHERE table_schema=${SCHEMA_NAME}))
+FROM information_schema.tables
+WHERE table_schema=${SCHEMA_NAME};
+)",
+	                                 "${SCHEMA_NAME}", MySQLUtils::WriteLiteral(schema_name));
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto result = transaction.Query(query);
+	if (!result->Next() || result->IsNull(0)) {
+		return string();
+	}
+	return result->GetString(0);
+}
+
+static void WriteCacheString(WriteStream &writer, const string &str) {
+	writer.Write<uint32_t>(NumericCast<uint32_t>(str.size()));
+	writer.WriteData(const_data_ptr_cast(str.c_str()), str.size());
+}
+
+static string ReadCacheString(ReadStream &reader) {
+	auto size = reader.Read<uint32_t>();
+	string result(size, '\0');
+	reader.ReadData(data_ptr_cast(&result[0]), size);
+	return result;
+}
+
+bool MySQLSchemaCache::TryLoad(vector<MySQLColumnInfo> &columns) {
+	if (path.empty()) {
+		return false;
+	}
+	fingerprint = GetFingerprint();
+	if (fingerprint.empty() || catalog.SchemaCacheInvalidated(schema_name)) {
+		return false;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	if (!fs.FileExists(path)) {
+		return false;
+	}
+	try {
+		BufferedFileReader reader(fs, path.c_str());
+		if (ReadCacheString(reader) != MYSQL_SCHEMA_CACHE_MAGIC ||
+		    reader.Read<uint32_t>() != MYSQL_SCHEMA_CACHE_VERSION) {
+			return false;
+		}
+		if (ReadCacheString(reader) != fingerprint) {
+			// the schema has changed since the cache was written
+			return false;
+		}
+		auto column_count = reader.Read<uint64_t>();
+		vector<MySQLColumnInfo> result;
+		for (idx_t i = 0; i < column_count; i++) {
+			MySQLColumnInfo column;
+			column.table_name = ReadCacheString(reader);
+			column.column_name = ReadCacheString(reader);
+			column.type_info.type_name = ReadCacheString(reader);
+			column.type_info.column_type = ReadCacheString(reader);
+			column.type_info.precision = reader.Read<int64_t>();
+			column.type_info.scale = reader.Read<int64_t>();
+			column.is_nullable = reader.Read<bool>();
+			column.column_key = ReadCacheString(reader);
+			result.push_back(std::move(column));
+		}
+		columns = std::move(result);
+		return true;
+	} catch (std::exception &) {
+		// the cache file is truncated or corrupt - reload the schema from the server
+		return false;
+	}
+}
+
+void MySQLSchemaCache::Store(const vector<MySQLColumnInfo> &columns) {
+	if (path.empty() || fingerprint.empty()) {
+		return;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	// write to a temporary file first, so that concurrent readers never observe a partially written cache
+	auto temp_path = path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+	try {
+		{
+			BufferedFileWriter writer(fs, temp_path);
+			WriteCacheString(writer, MYSQL_SCHEMA_CACHE_MAGIC);
+			writer.Write<uint32_t>(MYSQL_SCHEMA_CACHE_VERSION);
+			WriteCacheString(writer, fingerprint);
+			writer.Write<uint64_t>(columns.size());
+			for (auto &column : columns) {
+				WriteCacheString(writer, column.table_name);
+				WriteCacheString(writer, column.column_name);
+				WriteCacheString(writer, column.type_info.type_name);
+				WriteCacheString(writer, column.type_info.column_type);
+				writer.Write<int64_t>(column.type_info.precision);
+				writer.Write<int64_t>(column.type_info.scale);
+				writer.Write<bool>(column.is_nullable);
+				WriteCacheString(writer, column.column_key);
+			}
+			writer.Sync();
+		}
+		fs.MoveFile(temp_path, path);
+	} catch (std::exception &) {
+		// the cache cannot be written (e.g. the directory is read-only or the disk is full) - the schema has been
+		// loaded already, so the query goes on without the cache
+		try {
+			fs.TryRemoveFile(temp_path);
+		} catch (std::exception &) {
+			// the temporary file is left behind if it cannot be removed either
+		}
+	}
+}
+
+} // namespace duckdb
@@ -90,6 +90,7 @@ optional_ptr<CatalogEntry> MySQLSchemaEntry::CreateIndex(CatalogTransaction tran
                                                          TableCatalogEntry &table) {
 	auto &mysql_transaction = MySQLTransaction::Get(transaction.GetContext(), table.catalog);
 	mysql_transaction.Query(GetMySQLCreateIndex(info, table));
+	indexes.InvalidateEntry(info.index_name);
 	return nullptr;
 }
 
@@ -195,6 +196,16 @@ void MySQLSchemaEntry::Scan(CatalogType type, const std::function<void(CatalogEn
 
 void MySQLSchemaEntry::DropEntry(ClientContext &context, DropInfo &info) {
 	GetCatalogSet(info.type).DropEntry(context, info);
+	if (info.type == CatalogType::TABLE_ENTRY) {
+		// the indexes of the table are dropped with it
+		indexes.ClearEntries();
+	}
+}
+
+void MySQLSchemaEntry::InvalidateTable(const string &table_name) {
+	tables.InvalidateEntry(table_name);
+	// index entries are keyed by their own name - we do not know which belong to the table
+	indexes.ClearEntries();
 }
 
 optional_ptr<CatalogEntry> MySQLSchemaEntry::GetEntry(CatalogTransaction transaction, CatalogType type,
@@ -31,6 +31,28 @@ FROM information_schema.schemata;
 	}
 }
 
+optional_ptr<CatalogEntry> MySQLSchemaSet::LoadEntry(ClientContext &context, const string &name) {
+	auto query = "SELECT schema_name FROM information_schema.schemata WHERE LOWER(schema_name)=LOWER(" +
+	             MySQLUtils::WriteLiteral(name) + ")";
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto result = transaction.Query(query);
+	// schema names are looked up case-insensitively by DuckDB - prefer an exact match if there are several schemas
+	string found_name;
+	while (result->Next()) {
+		auto schema_name = result->GetString(0);
+		if (found_name.empty() || schema_name == name) {
+			found_name = schema_name;
+		}
+	}
+	if (found_name.empty()) {
+		return nullptr;
+	}
+	CreateSchemaInfo info;
+	info.schema = found_name;
+	info.internal = MySQLSchemaIsInternal(info.schema);
+	return CreateEntry(make_uniq<MySQLSchemaEntry>(catalog, info));
+}
+
 optional_ptr<CatalogEntry> MySQLSchemaSet::CreateSchema(ClientContext &context, CreateSchemaInfo &info) {
 	auto &transaction = MySQLTransaction::Get(context, catalog);
 
@@ -4,6 +4,8 @@
 #include "storage/mysql_transaction.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/parser/constraints/unique_constraint.hpp"
+#include "duckdb/common/map.hpp"
 #include "mysql_scanner.hpp"
 
 namespace duckdb {
@@ -70,15 +72,454 @@ static bool TableIsInternal(const SchemaCatalogEntry &schema, const string &name
 MySQLTableEntry::MySQLTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : TableCatalogEntry(catalog, schema, info) {
 	this->internal = TableIsInternal(schema, name);
+	for (auto &constraint : info.constraints) {
+		if (constraint->type != ConstraintType::UNIQUE) {
+			continue;
+		}
+		auto &unique = constraint->Cast<UniqueConstraint>();
+		if (!unique.is_primary_key) {
+			continue;
+		}
+		if (unique.index.index != DConstants::INVALID_INDEX) {
+			primary_key.push_back(info.columns.GetColumn(unique.index).Name());
+		} else {
+			primary_key = unique.columns;
+		}
+	}
 }
 
 MySQLTableEntry::MySQLTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, MySQLTableInfo &info)
-    : TableCatalogEntry(catalog, schema, *info.create_info) {
+    : TableCatalogEntry(catalog, schema, *info.create_info), primary_key(info.primary_key) {
 	this->internal = TableIsInternal(schema, name);
 }
 
+string MySQLTableEntry::GetRowIdColumn() const {
+	if (primary_key.size() != 1) {
+		return string();
+	}
+	auto &pk_column = GetColumn(primary_key[0]);
+	switch (pk_column.GetType().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+		return pk_column.GetName();
+	default:
+		return string();
+	}
+}
+
+static bool UseTableStatistics(ClientContext &context) {
+	Value use_statistics;
+	if (context.TryGetCurrentSetting("mysql_table_statistics", use_statistics)) {
+		return BooleanValue::Get(use_statistics);
+	}
+	return true;
+}
+
+//! Whether or not the create_options of information_schema.tables describe a partitioned table
+static bool IsPartitionedTable(MySQLResult &result, idx_t column) {
+	return !result.IsNull(column) && StringUtil::Contains(StringUtil::Lower(result.GetString(column)), "partitioned");
+}
+
+static unique_ptr<MySQLTableStatistics> LoadTableStatistics(MySQLTransaction &transaction, const string &schema_name,
+                                                            const string &table_name) {
+	auto result = make_uniq<MySQLTableStatistics>();
+	auto schema_literal = MySQLUtils::WriteLiteral(schema_name);
+	auto table_literal = MySQLUtils::WriteLiteral(table_name);
+	auto filter = " WHERE table_schema=" + schema_literal + " AND table_name=" + table_literal;
+
+	// the estimated row count - and whether or not the table is partitioned
+	auto rows_query = "SELECT table_rows, create_options, avg_row_length FROM information_schema.tables" + filter;
+	// distinct counts from the index statistics - the cardinality of the first column of an index is its distinct count
+	auto index_query = "SELECT column_name, MAX(cardinality) FROM information_schema.statistics" + filter +
+	                   " AND seq_in_index=1 AND cardinality IS NOT NULL GROUP BY column_name";
+	// distinct counts from histograms (created through ANALYZE TABLE ... UPDATE HISTOGRAM)
+	// singleton histograms have one bucket per value - equi-height buckets store their distinct count at index 3
+	string histogram_query = R"(
+SELECT cs.column_name, IF(MAX(JSON_UNQUOTE(JSON_EXTRACT(cs.histogram, '$."histogram-type"'))) = 'singleton', COUNT(*), SUM(b.distinct_count))
+FROM information_schema.column_statistics cs, JSON_TABLE(cs.histogram, '$.buckets[*]' COLUMNS (distinct_count BIGINT PATH '$[3]')) b
+WHERE cs.schema_name=${SCHEMA_NAME} AND cs.table_name=${TABLE_NAME}
+GROUP BY cs.column_name
+)";
+	histogram_query = StringUtil::Replace(histogram_query, "${SCHEMA_NAME}", schema_literal);
+	histogram_query = StringUtil::Replace(histogram_query, "${TABLE_NAME}", table_literal);
+
+	// the queries are sent in a single round trip
+	vector<unique_ptr<MySQLResult>> results;
+	try {
+		results = transaction.QueryMultiple({rows_query, index_query, histogram_query});
+	} catch (std::exception &) {
+		// histograms are only available in MySQL 8.0+
+		results = transaction.QueryMultiple({rows_query, index_query});
+	}
+	auto &rows = results[0];
+	if (rows->Next()) {
+		if (!rows->IsNull(0)) {
+			result->cardinality = NumericCast<idx_t>(MaxValue<int64_t>(rows->GetInt64(0), 0));
+		}
+		result->partitioned = IsPartitionedTable(*rows, 1);
+		if (!rows->IsNull(2)) {
+			result->average_row_size = NumericCast<idx_t>(MaxValue<int64_t>(rows->GetInt64(2), 0));
+		}
+	}
+	auto &indexes = results[1];
+	while (indexes->Next()) {
+		result->distinct_counts[indexes->GetString(0)] = NumericCast<idx_t>(MaxValue<int64_t>(indexes->GetInt64(1), 0));
+	}
+	if (results.size() > 2) {
+		auto &histograms = results[2];
+		while (histograms->Next()) {
+			if (histograms->IsNull(1)) {
+				continue;
+			}
+			auto column_name = histograms->GetString(0);
+			if (result->distinct_counts.find(column_name) != result->distinct_counts.end()) {
+				// prefer index statistics
+				continue;
+			}
+			result->distinct_counts[column_name] = NumericCast<idx_t>(MaxValue<int64_t>(histograms->GetInt64(1), 0));
+		}
+	}
+	return result;
+}
+
+void MySQLTableEntry::SetUniqueIndexes(const vector<pair<string, string>> &index_columns) {
+	map<string, IndexInfo> indexes;
+	unordered_set<string> expression_indexes;
+	for (auto &index_column : index_columns) {
+		auto &index_name = index_column.first;
+		if (index_column.second.empty() || !columns.ColumnExists(index_column.second)) {
+			// functional indexes have no column - they cannot be used as a conflict target
+			expression_indexes.insert(index_name);
+			continue;
+		}
+		auto &index = indexes[index_name];
+		index.is_unique = true;
+		index.is_primary = index_name == "PRIMARY";
+		index.is_foreign = false;
+		index.column_set.insert(columns.GetColumn(index_column.second).Logical().index);
+	}
+	auto result = make_uniq<vector<IndexInfo>>();
+	for (auto &entry : indexes) {
+		if (expression_indexes.find(entry.first) == expression_indexes.end()) {
+			result->push_back(std::move(entry.second));
+		}
+	}
+	lock_guard<mutex> l(statistics_lock);
+	if (!unique_indexes) {
+		unique_indexes = std::move(result);
+	}
+}
+
+//! Whether or not filters on a column of the given type can be compared against the bounds of partitions - strings
+//! are excluded, as MySQL compares them according to the collation of the column
+static bool CanPrunePartitions(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Returns the partitioning column of a partition expression - e.g. "`created_at`" - or an empty string if the
+//! table is partitioned by an expression or by several columns
+static string GetPartitionColumn(const MySQLTableEntry &table, const string &expression) {
+	auto column_name = expression;
+	StringUtil::Trim(column_name);
+	if (column_name.size() >= 2 && column_name.front() == '`' && column_name.back() == '`') {
+		column_name = column_name.substr(1, column_name.size() - 2);
+	}
+	auto &columns = table.GetColumns();
+	if (column_name.empty() || column_name.find('`') != string::npos || !columns.ColumnExists(column_name)) {
+		return string();
+	}
+	auto &column = columns.GetColumn(column_name);
+	if (!CanPrunePartitions(column.GetType())) {
+		return string();
+	}
+	return column.GetName();
+}
+
+struct MySQLPartitionValue {
+	string text;
+	bool quoted;
+};
+
+//! Splits the description of a partition - e.g. "100", "MAXVALUE", "'2024-01-01'" or "1,2,NULL" - into its values
+//! Returns false if the description cannot be split, e.g. for the value tuples of partitions over several columns
+static bool SplitPartitionDescription(const string &description, vector<MySQLPartitionValue> &result) {
+	idx_t pos = 0;
+	while (pos < description.size()) {
+		while (pos < description.size() && StringUtil::CharacterIsSpace(description[pos])) {
+			pos++;
+		}
+		MySQLPartitionValue value;
+		value.quoted = pos < description.size() && description[pos] == '\'';
+		if (value.quoted) {
+			// quotes in quoted values are doubled
+			for (pos++; pos < description.size(); pos++) {
+				if (description[pos] == '\'') {
+					if (pos + 1 < description.size() && description[pos + 1] == '\'') {
+						pos++;
+					} else {
+						break;
+					}
+				}
+				value.text += description[pos];
+			}
+			if (pos >= description.size()) {
+				return false;
+			}
+			pos++;
+		} else {
+			while (pos < description.size() && description[pos] != ',') {
+				value.text += description[pos++];
+			}
+			StringUtil::Trim(value.text);
+			if (value.text.empty() || value.text.find('(') != string::npos) {
+				return false;
+			}
+		}
+		while (pos < description.size() && StringUtil::CharacterIsSpace(description[pos])) {
+			pos++;
+		}
+		if (pos < description.size()) {
+			if (description[pos] != ',') {
+				return false;
+			}
+			pos++;
+		}
+		result.push_back(std::move(value));
+	}
+	return !result.empty();
+}
+
+//! Reads the bounds (RANGE) or values (LIST) of a partition from its description - returns false if they cannot be read
+static bool ReadPartitionDescription(MySQLPartitionMethod method, const LogicalType &type, const string &description,
+                                     MySQLPartitionInfo &partition) {
+	vector<MySQLPartitionValue> values;
+	if (!SplitPartitionDescription(description, values)) {
+		return false;
+	}
+	if (method == MySQLPartitionMethod::RANGE && values.size() != 1) {
+		return false;
+	}
+	for (auto &value : values) {
+		if (!value.quoted && StringUtil::CIEquals(value.text, "MAXVALUE")) {
+			if (method != MySQLPartitionMethod::RANGE) {
+				return false;
+			}
+			// unbounded
+			continue;
+		}
+		if (!value.quoted && StringUtil::CIEquals(value.text, "NULL")) {
+			if (method != MySQLPartitionMethod::LIST) {
+				return false;
+			}
+			partition.contains_null = true;
+			continue;
+		}
+		Value result;
+		if (!Value(value.text).DefaultTryCastAs(type, result, nullptr, true)) {
+			return false;
+		}
+		if (method == MySQLPartitionMethod::RANGE) {
+			partition.upper_bound = std::move(result);
+		} else {
+			partition.values.push_back(std::move(result));
+		}
+	}
+	return true;
+}
+
+unique_ptr<MySQLTablePartitions> MySQLTableEntry::LoadPartitions(ClientContext &context) {
+	auto &table = *this;
+	// subpartitions are scanned (and pruned) together with their partition
+	auto query = "SELECT partition_name, partition_method, partition_expression, partition_description, "
+	             "CAST(SUM(IFNULL(table_rows, 0)) AS UNSIGNED) FROM information_schema.partitions WHERE table_schema=" +
+	             MySQLUtils::WriteLiteral(table.schema.name) + " AND table_name=" + MySQLUtils::WriteLiteral(table.name) +
+	             " AND partition_name IS NOT NULL GROUP BY partition_name, partition_ordinal_position, "
+	             "partition_method, partition_expression, partition_description ORDER BY partition_ordinal_position";
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto result = transaction.Query(query);
+	auto partitions = make_uniq<MySQLTablePartitions>();
+	bool prunable = true;
+	while (result->Next()) {
+		MySQLPartitionInfo partition;
+		partition.name = result->GetString(0);
+		partition.estimated_rows = NumericCast<idx_t>(MaxValue<int64_t>(result->GetInt64(4), 0));
+		if (partitions->partitions.empty()) {
+			auto method = result->IsNull(1) ? string() : result->GetString(1);
+			if (StringUtil::StartsWith(method, "RANGE")) {
+				partitions->method = MySQLPartitionMethod::RANGE;
+			} else if (StringUtil::StartsWith(method, "LIST")) {
+				partitions->method = MySQLPartitionMethod::LIST;
+			} else {
+				partitions->method = MySQLPartitionMethod::HASH;
+			}
+			if (partitions->method != MySQLPartitionMethod::HASH && !result->IsNull(2)) {
+				partitions->column_name = GetPartitionColumn(table, result->GetString(2));
+			}
+			// NULL values are stored in the first partition of RANGE partitioned tables
+			partition.contains_null = partitions->method == MySQLPartitionMethod::RANGE;
+		} else if (partitions->method == MySQLPartitionMethod::RANGE) {
+			partition.lower_bound = partitions->partitions.back().upper_bound;
+		}
+		if (prunable && !partitions->column_name.empty()) {
+			auto &type = table.GetColumn(partitions->column_name).GetType();
+			prunable = !result->IsNull(3) &&
+			           ReadPartitionDescription(partitions->method, type, result->GetString(3), partition);
+		}
+		partitions->partitions.push_back(std::move(partition));
+	}
+	if (!prunable) {
+		// the partitions are still scanned separately - they just cannot be pruned
+		partitions->column_name = string();
+	}
+	return partitions;
+}
+
+const MySQLTableStatistics &MySQLTableEntry::GetTableStatistics(ClientContext &context) {
+	lock_guard<mutex> l(statistics_lock);
+	if (!statistics) {
+		auto &transaction = MySQLTransaction::Get(context, catalog);
+		statistics = LoadTableStatistics(transaction, schema.name, name);
+	}
+	return *statistics;
+}
+
+optional_ptr<const MySQLTableStatistics> MySQLTableEntry::TryGetTableStatistics() {
+	lock_guard<mutex> l(statistics_lock);
+	return statistics.get();
+}
+
+bool MySQLTableEntry::IsPartitioned(ClientContext &context) {
+	{
+		lock_guard<mutex> l(statistics_lock);
+		if (statistics) {
+			return statistics->partitioned;
+		}
+		if (partitioned) {
+			return *partitioned;
+		}
+	}
+	// a single row of information_schema.tables - rather than all statistics (which might be disabled)
+	auto query = "SELECT create_options FROM information_schema.tables WHERE table_schema=" +
+	             MySQLUtils::WriteLiteral(schema.name) + " AND table_name=" + MySQLUtils::WriteLiteral(name);
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto result = transaction.Query(query);
+	auto is_partitioned = result->Next() && IsPartitionedTable(*result, 0);
+	lock_guard<mutex> l(statistics_lock);
+	partitioned = make_uniq<bool>(is_partitioned);
+	return is_partitioned;
+}
+
+const vector<IndexInfo> &MySQLTableEntry::GetUniqueIndexes(ClientContext &context) {
+	{
+		lock_guard<mutex> l(statistics_lock);
+		if (unique_indexes) {
+			return *unique_indexes;
+		}
+	}
+	// the indexes are requested for every table when listing tables - they are loaded for all tables of the schema
+	// at once (without holding the lock, as the indexes of the other tables are set as well)
+	schema.Cast<MySQLSchemaEntry>().LoadUniqueIndexes(context, *this);
+	lock_guard<mutex> l(statistics_lock);
+	return *unique_indexes;
+}
+
+//! Returns the estimated number of rows matching the condition from the plan of the optimizer of MySQL
+//! The (tabular) plan has rows (the rows the table access examines) and filtered (the percentage of these rows that
+//! are estimated to match the condition) columns
+static idx_t LoadFilteredCardinality(ClientContext &context, MySQLTransaction &transaction,
+                                     const MySQLTableEntry &table, const string &condition) {
+	auto query = "EXPLAIN SELECT * FROM " + MySQLUtils::WriteIdentifier(table.schema.name) + "." +
+	             MySQLUtils::WriteIdentifier(table.name) + " WHERE " + condition;
+	auto result = transaction.GetConnection().Query(query, &context);
+	optional_idx rows_index, filtered_index, extra_index;
+	auto &fields = result->Fields();
+	for (idx_t c = 0; c < fields.size(); c++) {
+		if (fields[c].name == "rows") {
+			rows_index = c;
+		} else if (fields[c].name == "filtered") {
+			filtered_index = c;
+		} else if (fields[c].name == "Extra") {
+			extra_index = c;
+		}
+	}
+	if (!rows_index.IsValid() || !result->Next()) {
+		return DConstants::INVALID_INDEX;
+	}
+	if (result->IsNull(rows_index.GetIndex())) {
+		// the optimizer found that no rows can match (e.g. "Impossible WHERE") - there is no table access
+		auto extra = extra_index.IsValid() && !result->IsNull(extra_index.GetIndex())
+		                 ? result->GetString(extra_index.GetIndex())
+		                 : string();
+		return StringUtil::Contains(extra, "Impossible") || StringUtil::Contains(extra, "no matching row")
+		           ? 0
+		           : DConstants::INVALID_INDEX;
+	}
+	auto rows = static_cast<double>(MaxValue<int64_t>(result->GetInt64(rows_index.GetIndex()), 0));
+	if (filtered_index.IsValid() && !result->IsNull(filtered_index.GetIndex())) {
+		auto filtered = Value(result->GetString(filtered_index.GetIndex())).DefaultCastAs(LogicalType::DOUBLE);
+		rows = rows * DoubleValue::Get(filtered) / 100.0;
+	}
+	return LossyNumericCast<idx_t>(rows);
+}
+
+bool MySQLTableEntry::GetFilteredCardinality(ClientContext &context, const string &condition, idx_t &result) {
+	lock_guard<mutex> l(statistics_lock);
+	auto entry = filtered_cardinalities.find(condition);
+	if (entry == filtered_cardinalities.end()) {
+		idx_t cardinality;
+		try {
+			auto &transaction = MySQLTransaction::Get(context, catalog);
+			cardinality = LoadFilteredCardinality(context, transaction, *this, condition);
+		} catch (std::exception &) {
+			// the estimate is only used for planning - fall back to the table statistics
+			cardinality = DConstants::INVALID_INDEX;
+		}
+		if (filtered_cardinalities.size() >= MAX_FILTERED_CARDINALITIES) {
+			filtered_cardinalities.clear();
+		}
+		entry = filtered_cardinalities.emplace(condition, cardinality).first;
+	}
+	if (entry->second == DConstants::INVALID_INDEX) {
+		return false;
+	}
+	result = entry->second;
+	return true;
+}
+
 unique_ptr<BaseStatistics> MySQLTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
-	return nullptr;
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID || !UseTableStatistics(context)) {
+		return nullptr;
+	}
+	auto &table_stats = GetTableStatistics(context);
+	auto &column = columns.GetColumn(LogicalIndex(column_id));
+	auto entry = table_stats.distinct_counts.find(column.GetName());
+	if (entry == table_stats.distinct_counts.end()) {
+		return nullptr;
+	}
+	// we only report distinct counts - MySQL's statistics are estimates that can be stale, while DuckDB uses
+	// min/max statistics to prune filters, which must never be wrong
+	auto result = BaseStatistics::CreateUnknown(column.GetType());
+	result.SetDistinctCount(MinValue<idx_t>(entry->second, MaxValue<idx_t>(table_stats.cardinality, 1)));
+	return result.ToUnique();
 }
 
 void MySQLTableEntry::BindUpdateConstraints(Binder &binder, LogicalGet &, LogicalProjection &, LogicalUpdate &,
@@ -91,6 +532,16 @@ TableFunction MySQLTableEntry::GetScanFunction(ClientContext &context, unique_pt
 		result->types.push_back(col.GetType());
 		result->names.push_back(col.GetName());
 	}
+	Value partition_scan;
+	if (!context.TryGetCurrentSetting("mysql_partition_scan", partition_scan) || BooleanValue::Get(partition_scan)) {
+		// whether or not the table is partitioned is cached with the entry - the partitions themselves are read for
+		// every scan of a partitioned table, so that scans are never restricted to partitions that are outdated. They
+		// are read while binding, as the connection of the transaction can be busy streaming the result of another
+		// scan by the time the scan is initialized.
+		if (IsPartitioned(context)) {
+			result->partitions = LoadPartitions(context);
+		}
+	}
 
 	bind_data = std::move(result);
 
@@ -99,15 +550,22 @@ TableFunction MySQLTableEntry::GetScanFunction(ClientContext &context, unique_pt
 	if (context.TryGetCurrentSetting("mysql_experimental_filter_pushdown", filter_pushdown)) {
 		function.filter_pushdown = BooleanValue::Get(filter_pushdown);
 	}
+	Value explain_cardinality;
+	if (!context.TryGetCurrentSetting("mysql_explain_cardinality", explain_cardinality) ||
+	    !BooleanValue::Get(explain_cardinality)) {
+		function.pushdown_complex_filter = nullptr;
+	}
 	return function;
 }
 
 TableStorageInfo MySQLTableEntry::GetStorageInfo(ClientContext &context) {
-	auto &transaction = Transaction::Get(context, catalog).Cast<MySQLTransaction>();
-	auto &db = transaction.GetConnection();
 	TableStorageInfo result;
-	result.cardinality = 0;
-	result.index_info = db.GetIndexInfo(name);
+	// the storage info is requested for every table when listing tables (e.g. through duckdb_tables()) - only report
+	// statistics that have already been loaded by a scan, rather than sending a query per table
+	auto table_stats = TryGetTableStatistics();
+	result.cardinality = table_stats && UseTableStatistics(context) ? table_stats->cardinality : 0;
+	// the unique indexes are used by DuckDB to bind ON CONFLICT clauses
+	result.index_info = GetUniqueIndexes(context);
 	return result;
 }
 
@@ -9,6 +9,8 @@
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "storage/mysql_schema_entry.hpp"
+#include "storage/mysql_schema_cache.hpp"
+#include "storage/mysql_catalog.hpp"
 #include "duckdb/parser/parser.hpp"
 
 namespace duckdb {
@@ -16,19 +18,28 @@ namespace duckdb {
 MySQLTableSet::MySQLTableSet(MySQLSchemaEntry &schema) : MySQLInSchemaSet(schema) {
 }
 
-void MySQLTableSet::AddColumn(ClientContext &context, MySQLResult &result, MySQLTableInfo &table_info,
-                              idx_t column_offset) {
-	MySQLTypeData type_info;
+MySQLColumnInfo MySQLTableSet::ReadColumn(MySQLResult &result, idx_t column_offset) {
+	MySQLColumnInfo column;
 	idx_t column_index = column_offset;
-	auto column_name = result.GetString(column_index);
-	type_info.type_name = result.GetString(column_index + 1);
-	type_info.column_type = result.GetString(column_index + 2);
+	column.column_name = result.GetString(column_index);
+	column.type_info.type_name = result.GetString(column_index + 1);
+	column.type_info.column_type = result.GetString(column_index + 2);
+	column.is_nullable = result.GetString(column_index + 4) == "YES";
+	column.type_info.precision = result.IsNull(column_index + 5) ? -1 : result.GetInt64(column_index + 5);
+	column.type_info.scale = result.IsNull(column_index + 6) ? -1 : result.GetInt64(column_index + 6);
+	column.column_key = result.IsNull(column_index + 7) ? string() : result.GetString(column_index + 7);
+	return column;
+}
+
+void MySQLTableSet::AddColumn(ClientContext &context, const MySQLColumnInfo &column_info,
+                              MySQLTableInfo &table_info) {
 	string default_value;
-	auto is_nullable = result.GetString(column_index + 4);
-	type_info.precision = result.IsNull(column_index + 5) ? -1 : result.GetInt64(column_index + 5);
-	type_info.scale = result.IsNull(column_index + 6) ? -1 : result.GetInt64(column_index + 6);
+	auto column_name = column_info.column_name;
+	if (column_info.column_key == "PRI") {
+		table_info.primary_key.push_back(column_name);
+	}
 
-	auto column_type = MySQLUtils::TypeToLogicalType(context, type_info);
+	auto column_type = MySQLUtils::TypeToLogicalType(context, column_info.type_info);
 	ColumnDefinition column(std::move(column_name), std::move(column_type));
 	if (!default_value.empty()) {
 		auto expressions = Parser::ParseExpressionList(default_value);
@@ -38,16 +49,21 @@ void MySQLTableSet::AddColumn(ClientContext &context, MySQLResult &result, MySQL
 		column.SetDefaultValue(std::move(expressions[0]));
 	}
 	auto &create_info = *table_info.create_info;
-	if (is_nullable != "YES") {
+	if (!column_info.is_nullable) {
 		auto column_idx = create_info.columns.LogicalColumnCount();
 		create_info.constraints.push_back(make_uniq<NotNullConstraint>(LogicalIndex(column_idx)));
 	}
 	create_info.columns.AddColumn(std::move(column));
 }
 
-void MySQLTableSet::LoadEntries(ClientContext &context) {
+void MySQLTableSet::AddColumn(ClientContext &context, MySQLResult &result, MySQLTableInfo &table_info,
+                              idx_t column_offset) {
+	AddColumn(context, ReadColumn(result, column_offset), table_info);
+}
+
+vector<MySQLColumnInfo> MySQLTableSet::LoadColumns(ClientContext &context) {
 	auto query = StringUtil::Replace(R"(
-SELECT table_name, column_name, data_type, column_type, column_default, is_nullable, numeric_precision, numeric_scale
+SELECT table_name, column_name, data_type, column_type, column_default, is_nullable, numeric_precision, numeric_scale, column_key
 FROM information_schema.columns
 WHERE table_schema=${SCHEMA_NAME}
 ORDER BY table_name, ordinal_position;
@@ -57,18 +73,69 @@ ORDER BY table_name, ordinal_position;
 	auto &transaction = MySQLTransaction::Get(context, catalog);
 	auto result = transaction.Query(query);
 
-	vector<unique_ptr<MySQLTableInfo>> tables;
-	unique_ptr<MySQLTableInfo> info;
+	vector<MySQLColumnInfo> columns;
+	while (result->Next()) {
+		auto column = ReadColumn(*result, 1);
+		column.table_name = result->GetString(0);
+		columns.push_back(std::move(column));
+	}
+	return columns;
+}
+
+unordered_map<string, vector<MySQLColumnInfo>>
+MySQLTableSet::LoadColumns(ClientContext &context, Catalog &catalog, const vector<string> &schema_names) {
+	string schema_list;
+	for (auto &schema_name : schema_names) {
+		if (!schema_list.empty()) {
+			schema_list += ", ";
+		}
+		schema_list += MySQLUtils::WriteLiteral(schema_name);
+	}
+	auto query = StringUtil::Replace(R"(
+SELECT table_schema, table_name, column_name, data_type, column_type, column_default, is_nullable, numeric_precision, numeric_scale, column_key
+FROM information_schema.columns
+WHERE table_schema IN (${SCHEMA_NAMES})
+ORDER BY table_schema, table_name, ordinal_position;
+)",
+	                                 "${SCHEMA_NAMES}", schema_list);
 
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto result = transaction.Query(query);
+
+	unordered_map<string, vector<MySQLColumnInfo>> columns;
+	for (auto &schema_name : schema_names) {
+		// schemas without any tables have no columns
+		columns[schema_name];
+	}
 	while (result->Next()) {
-		auto table_name = result->GetString(0);
-		if (!info || info->GetTableName() != table_name) {
+		auto column = ReadColumn(*result, 2);
+		column.table_name = result->GetString(1);
+		columns[result->GetString(0)].push_back(std::move(column));
+	}
+	return columns;
+}
+
+void MySQLTableSet::LoadEntries(ClientContext &context) {
+	vector<MySQLColumnInfo> columns;
+	auto &mysql_catalog = catalog.Cast<MySQLCatalog>();
+	MySQLSchemaCache schema_cache(context, mysql_catalog, schema.name);
+	if (!schema_cache.TryLoad(columns)) {
+		if (!mysql_catalog.TryGetPrefetchedColumns(context, schema.name, columns)) {
+			columns = LoadColumns(context);
+		}
+		schema_cache.Store(columns);
+	}
+
+	vector<unique_ptr<MySQLTableInfo>> tables;
+	unique_ptr<MySQLTableInfo> info;
+	for (auto &column : columns) {
+		if (!info || info->GetTableName() != column.table_name) {
 			if (info) {
 				tables.push_back(std::move(info));
 			}
-			info = make_uniq<MySQLTableInfo>(schema, table_name);
+			info = make_uniq<MySQLTableInfo>(schema, column.table_name);
 		}
-		AddColumn(context, *result, *info, 1);
+		AddColumn(context, column, *info);
 	}
 	if (info) {
 		tables.push_back(std::move(info));
@@ -79,9 +146,34 @@ ORDER BY table_name, ordinal_position;
 	}
 }
 
+void MySQLTableSet::LoadUniqueIndexes(ClientContext &context, MySQLTableEntry &table) {
+	auto query = "SELECT table_name, index_name, column_name FROM information_schema.statistics WHERE table_schema=" +
+	             MySQLUtils::WriteLiteral(schema.name) + " AND non_unique=0";
+	if (!IsLoaded()) {
+		query += " AND table_name=" + MySQLUtils::WriteLiteral(table.name);
+	}
+	query += " ORDER BY table_name, index_name, seq_in_index";
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto result = transaction.Query(query);
+	unordered_map<string, vector<pair<string, string>>> index_columns;
+	while (result->Next()) {
+		auto column_name = result->IsNull(2) ? string() : result->GetString(2);
+		index_columns[result->GetString(0)].emplace_back(result->GetString(1), std::move(column_name));
+	}
+	// tables without unique indexes have no rows
+	vector<pair<string, string>> no_indexes;
+	ScanLoadedEntries([&](CatalogEntry &entry) {
+		auto indexes = index_columns.find(entry.name);
+		entry.Cast<MySQLTableEntry>().SetUniqueIndexes(indexes == index_columns.end() ? no_indexes : indexes->second);
+	});
+	// the table itself may no longer be in the set (e.g. if it was invalidated in the meantime)
+	auto indexes = index_columns.find(table.name);
+	table.SetUniqueIndexes(indexes == index_columns.end() ? no_indexes : indexes->second);
+}
+
 string GetTableInfoQuery(const string &schema_name, const string &table_name) {
 	return StringUtil::Replace(StringUtil::Replace(R"(
-SELECT column_name, data_type, column_type, column_default, is_nullable, numeric_precision, numeric_scale
+SELECT column_name, data_type, column_type, column_default, is_nullable, numeric_precision, numeric_scale, column_key
 FROM information_schema.columns
 WHERE table_schema=${SCHEMA_NAME} AND table_name=${TABLE_NAME}
 ORDER BY table_name, ordinal_position;
@@ -102,12 +194,45 @@ unique_ptr<MySQLTableInfo> MySQLTableSet::GetTableInfo(ClientContext &context, M
 	return table_info;
 }
 
+optional_ptr<CatalogEntry> MySQLTableSet::LoadEntry(ClientContext &context, const string &table_name) {
+	// table names are looked up case-insensitively by DuckDB - prefer an exact match if there are several tables
+	auto query = StringUtil::Replace(StringUtil::Replace(R"(
+SELECT table_name, column_name, data_type, column_type, column_default, is_nullable, numeric_precision, numeric_scale, column_key
+FROM information_schema.columns
+WHERE table_schema=${SCHEMA_NAME} AND LOWER(table_name)=LOWER(${TABLE_NAME})
+ORDER BY table_name, ordinal_position;
+)",
+	                                                     "${SCHEMA_NAME}", MySQLUtils::WriteLiteral(schema.name)),
+	                                 "${TABLE_NAME}", MySQLUtils::WriteLiteral(table_name));
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	auto result = transaction.Query(query);
+	vector<MySQLColumnInfo> columns;
+	string found_name;
+	while (result->Next()) {
+		auto column = ReadColumn(*result, 1);
+		column.table_name = result->GetString(0);
+		if (found_name.empty() || column.table_name == table_name) {
+			found_name = column.table_name;
+		}
+		columns.push_back(std::move(column));
+	}
+	if (found_name.empty()) {
+		return nullptr;
+	}
+	auto table_info = make_uniq<MySQLTableInfo>(schema, found_name);
+	for (auto &column : columns) {
+		if (column.table_name == found_name) {
+			AddColumn(context, column, *table_info);
+		}
+	}
+	auto table_entry = make_uniq<MySQLTableEntry>(catalog, schema, *table_info);
+	return CreateEntry(std::move(table_entry));
+}
+
 optional_ptr<CatalogEntry> MySQLTableSet::RefreshTable(ClientContext &context, const string &table_name) {
 	auto table_info = GetTableInfo(context, schema, table_name);
 	auto table_entry = make_uniq<MySQLTableEntry>(catalog, schema, *table_info);
-	auto table_ptr = table_entry.get();
-	CreateEntry(std::move(table_entry));
-	return table_ptr;
+	return CreateEntry(std::move(table_entry));
 }
 
 // FIXME - this is almost entirely copied from TableCatalogEntry::ColumnsToSQL -
@@ -293,7 +418,13 @@ void MySQLTableSet::AlterTable(ClientContext &context, AlterTableInfo &alter) {
 		                      "support RENAME TABLE, RENAME COLUMN, "
 		                      "ADD COLUMN and DROP COLUMN");
 	}
-	ClearEntries();
+	catalog.Cast<MySQLCatalog>().GetResultCache().Clear();
+	catalog.Cast<MySQLCatalog>().GetCachedTables().InvalidateAll();
+	// only the altered table is reloaded - other tables of the schema are not affected
+	InvalidateEntry(alter.name);
+	if (alter.alter_table_type == AlterTableType::RENAME_TABLE) {
+		InvalidateEntry(alter.Cast<RenameTableInfo>().new_table_name);
+	}
 }
 
 } // namespace duckdb
@@ -8,11 +8,29 @@
 namespace duckdb {
 
 MySQLTransaction::MySQLTransaction(MySQLCatalog &mysql_catalog, TransactionManager &manager, ClientContext &context)
-    : Transaction(manager, context), access_mode(mysql_catalog.access_mode) {
-	connection = MySQLConnection::Open(mysql_catalog.connection_string);
+    : Transaction(manager, context), mysql_catalog(mysql_catalog),
+      connection_pool(mysql_catalog.GetConnectionPoolPtr()), access_mode(mysql_catalog.access_mode),
+      watermarks(mysql_catalog.GetWatermarks()), replica_router(mysql_catalog.GetReplicaRouter()) {
+	if (access_mode == AccessMode::READ_ONLY && replica_router.HasReplicas()) {
+		// read-only transactions are routed to a replica - all of their reads (including snapshot connections) are
+		// served by that same replica. If no replica is available the primary is used.
+		replica_index = replica_router.Acquire(context, connection);
+		if (replica_index.IsValid()) {
+			connection_pool = replica_router.GetConnectionPool(replica_index.GetIndex());
+			return;
+		}
+	}
+	connection = connection_pool->Acquire(context);
 }
 
-MySQLTransaction::~MySQLTransaction() = default;
+MySQLTransaction::~MySQLTransaction() {
+	if (connection_reusable) {
+		connection_pool->Release(std::move(connection));
+	}
+	if (replica_index.IsValid()) {
+		replica_router.Finish(replica_index.GetIndex());
+	}
+}
 
 void MySQLTransaction::Start() {
 	transaction_state = MySQLTransactionState::TRANSACTION_NOT_YET_STARTED;
@@ -21,40 +39,140 @@ void MySQLTransaction::Commit() {
 	if (transaction_state == MySQLTransactionState::TRANSACTION_STARTED) {
 		transaction_state = MySQLTransactionState::TRANSACTION_FINISHED;
 		connection.Execute("COMMIT");
+		connection_reusable = true;
+	}
+	for (auto &watermark : pending_watermarks) {
+		watermarks.Set(watermark.first, std::move(watermark.second));
 	}
+	pending_watermarks.clear();
+	DropPendingTables();
+	InvalidatePendingTables();
 }
 void MySQLTransaction::Rollback() {
 	if (transaction_state == MySQLTransactionState::TRANSACTION_STARTED) {
 		transaction_state = MySQLTransactionState::TRANSACTION_FINISHED;
 		connection.Execute("ROLLBACK");
+		connection_reusable = true;
 	}
+	pending_watermarks.clear();
+	DropPendingTables();
+	InvalidatePendingTables();
 }
 
-MySQLConnection &MySQLTransaction::GetConnection() {
-	if (transaction_state == MySQLTransactionState::TRANSACTION_NOT_YET_STARTED) {
-		transaction_state = MySQLTransactionState::TRANSACTION_STARTED;
-		string query = "START TRANSACTION";
-		if (access_mode == AccessMode::READ_ONLY) {
-			query += " READ ONLY";
+void MySQLTransaction::DropTableOnCompletion(const string &table_name) {
+	pending_drops.push_back(table_name);
+}
+
+void MySQLTransaction::SetWatermarkOnCommit(const string &name, string watermark) {
+	lock_guard<mutex> l(watermark_lock);
+	pending_watermarks.emplace_back(name, std::move(watermark));
+}
+
+void MySQLTransaction::InvalidateTableOnCompletion(const string &schema_name, const string &table_name) {
+	lock_guard<mutex> l(invalidation_lock);
+	pending_invalidations.emplace_back(schema_name, table_name);
+}
+
+void MySQLTransaction::InvalidateAllOnCompletion() {
+	lock_guard<mutex> l(invalidation_lock);
+	pending_invalidate_all = true;
+}
+
+void MySQLTransaction::InvalidatePendingTables() {
+	lock_guard<mutex> l(invalidation_lock);
+	if (pending_invalidate_all) {
+		mysql_catalog.GetResultCache().Clear();
+		mysql_catalog.GetCachedTables().InvalidateAll();
+	} else {
+		for (auto &table : pending_invalidations) {
+			mysql_catalog.GetResultCache().InvalidateTable(MySQLResultCache::GetTableKey(table.first, table.second));
+			mysql_catalog.GetCachedTables().InvalidateTable(table.first, table.second);
 		}
+	}
+	pending_invalidations.clear();
+	pending_invalidate_all = false;
+}
+
+void MySQLTransaction::DropPendingTables() {
+	auto tables = std::move(pending_drops);
+	pending_drops.clear();
+	for (auto &table_name : tables) {
+		connection.Execute("DROP TABLE IF EXISTS " + table_name);
+	}
+}
+
+void MySQLTransaction::StartTransaction(bool consistent_snapshot) {
+	D_ASSERT(transaction_state == MySQLTransactionState::TRANSACTION_NOT_YET_STARTED);
+	transaction_state = MySQLTransactionState::TRANSACTION_STARTED;
+	connection_reusable = false;
+	string query = "START TRANSACTION";
+	if (consistent_snapshot) {
+		query += " WITH CONSISTENT SNAPSHOT";
+	}
+	if (access_mode == AccessMode::READ_ONLY) {
+		query += consistent_snapshot ? ", READ ONLY" : " READ ONLY";
+	}
+	if (consistent_snapshot) {
+		// the snapshot has to be taken right away (while commits are blocked)
 		connection.Execute(query);
+	} else {
+		// send START TRANSACTION together with the first query of the transaction instead of by itself
+		connection.QueueStatement(std::move(query));
+	}
+}
+
+MySQLConnection &MySQLTransaction::GetConnection() {
+	if (transaction_state == MySQLTransactionState::TRANSACTION_NOT_YET_STARTED) {
+		StartTransaction(false);
 	}
 	return connection;
 }
 
 unique_ptr<MySQLResult> MySQLTransaction::Query(const string &query) {
 	if (transaction_state == MySQLTransactionState::TRANSACTION_NOT_YET_STARTED) {
-		transaction_state = MySQLTransactionState::TRANSACTION_STARTED;
-		string transaction_start = "START TRANSACTION";
-		if (access_mode == AccessMode::READ_ONLY) {
-			transaction_start += " READ ONLY";
-		}
-		connection.Query(transaction_start);
-		return connection.Query(query);
+		StartTransaction(false);
 	}
 	return connection.Query(query);
 }
 
+vector<unique_ptr<MySQLResult>> MySQLTransaction::QueryMultiple(const vector<string> &queries) {
+	if (transaction_state == MySQLTransactionState::TRANSACTION_NOT_YET_STARTED) {
+		StartTransaction(false);
+	}
+	return connection.QueryMultiple(queries);
+}
+
+vector<MySQLConnection> MySQLTransaction::StartSnapshotConnections(ClientContext &context, idx_t count,
+                                                                   const string &table_name) {
+	// block all commits while the snapshots are taken, so that every connection sees the same committed data
+	auto lock_connection = connection_pool->Acquire(context);
+	try {
+		lock_connection.Execute("FLUSH TABLES WITH READ LOCK");
+	} catch (std::exception &) {
+		// FLUSH TABLES WITH READ LOCK requires the RELOAD privilege - fall back to blocking writes to the table
+		lock_connection.Execute("LOCK TABLES " + table_name + " READ");
+	}
+	// if anything fails from here on the lock connection is closed - which releases the lock
+	vector<MySQLConnection> result;
+	for (idx_t i = 0; i < count; i++) {
+		auto snapshot_connection = connection_pool->Acquire(context);
+		snapshot_connection.Execute("START TRANSACTION WITH CONSISTENT SNAPSHOT, READ ONLY");
+		result.push_back(std::move(snapshot_connection));
+	}
+	if (transaction_state == MySQLTransactionState::TRANSACTION_NOT_YET_STARTED) {
+		// the transaction has not read anything yet - let it share the snapshot as well
+		StartTransaction(true);
+	}
+	lock_connection.Execute("UNLOCK TABLES");
+	connection_pool->Release(std::move(lock_connection));
+	return result;
+}
+
+bool MySQLTransaction::CanUseSeparateConnection(ClientContext &context, Catalog &catalog) {
+	auto &transaction = MySQLTransaction::Get(context, catalog);
+	return transaction.GetAccessMode() == AccessMode::READ_ONLY || context.transaction.IsAutoCommit();
+}
+
 MySQLTransaction &MySQLTransaction::Get(ClientContext &context, Catalog &catalog) {
 	return Transaction::Get(context, catalog).Cast<MySQLTransaction>();
 }